@@ -18,6 +18,10 @@ namespace s3d
 	/// <summary>
 	/// アーカイブの読み込み
 	/// </summary>
+	/// <remarks>
+	/// 元の Reader が位置を指定した読み込みをサポートしている場合は、読み込み位置を共有しないため、
+	/// 同じアーカイブの複数のファイルを別々のスレッドからロックなしで読み込むことができます。
+	/// </remarks>
 	class ArchivedFileReader : public IReader
 	{
 	private:
@@ -131,9 +135,18 @@ namespace s3d
 				size = m_size - m_pos;
 			}
 
-			m_reader->setPos(m_offset + m_pos);
+			int64 readSize;
 
-			const int64 readSize = m_reader->read(buffer, size);
+			if (m_reader->supportsPositionalRead())
+			{
+				readSize = m_reader->readAt(buffer, m_offset + m_pos, size);
+			}
+			else
+			{
+				m_reader->setPos(m_offset + m_pos);
+
+				readSize = m_reader->read(buffer, size);
+			}
 
 			m_pos += readSize;
 
@@ -162,9 +175,44 @@ namespace s3d
 				size = m_size - pos;
 			}
 
+			if (m_reader->supportsPositionalRead())
+			{
+				return m_reader->readAt(buffer, m_offset + pos, size);
+			}
+
 			return m_reader->read(buffer, m_offset + pos, size);
 		}
 
+		bool supportsPositionalRead() const override
+		{
+			if (!m_reader)
+			{
+				return false;
+			}
+
+			return m_reader->supportsPositionalRead();
+		}
+
+		int64 readAt(void* buffer, int64 pos, int64 size) const override
+		{
+			if (!m_reader)
+			{
+				return 0;
+			}
+
+			if (pos < 0 || pos > m_size)
+			{
+				return 0;
+			}
+
+			if (pos + size > m_size)
+			{
+				size = m_size - pos;
+			}
+
+			return m_reader->readAt(buffer, m_offset + pos, size);
+		}
+
 		bool supportsLookahead() const override
 		{
 			if (!m_reader)
@@ -187,6 +235,11 @@ namespace s3d
 				size = m_size - m_pos;
 			}
 
+			if (m_reader->supportsPositionalRead())
+			{
+				return m_reader->readAt(buffer, m_offset + m_pos, size);
+			}
+
 			return m_reader->lookahead(buffer, m_offset + m_pos, size);
 		}
 
@@ -212,6 +265,11 @@ namespace s3d
 				size = m_size - pos;
 			}
 
+			if (m_reader->supportsPositionalRead())
+			{
+				return m_reader->readAt(buffer, m_offset + pos, size);
+			}
+
 			return m_reader->lookahead(buffer, m_offset + pos, size);
 		}
 	};
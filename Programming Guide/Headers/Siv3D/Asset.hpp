@@ -42,6 +42,11 @@ namespace s3d
 			/// </summary>
 			LoadImmediately = 0x2,
 
+			/// <summary>
+			/// メモリ予算を超えても自動的にリリースしない
+			/// </summary>
+			Resident = 0x4,
+
 			/// <summary>
 			/// デフォルト
 			/// </summary>
@@ -49,6 +54,54 @@ namespace s3d
 		};
 	};
 
+	/// <summary>
+	/// 非同期プリロードの進捗
+	/// </summary>
+	struct AssetLoadProgress
+	{
+		/// <summary>
+		/// 要求されたアセットの数
+		/// </summary>
+		size_t numRequested = 0;
+
+		/// <summary>
+		/// ワーカースレッドでのデコードが終わったアセットの数
+		/// </summary>
+		size_t numDecoded = 0;
+
+		/// <summary>
+		/// メインスレッドでのアップロードまで終わったアセットの数
+		/// </summary>
+		size_t numCompleted = 0;
+
+		/// <summary>
+		/// プリロードに失敗したアセットの数
+		/// </summary>
+		size_t numFailed = 0;
+
+		/// <summary>
+		/// 進捗の割合を返します。
+		/// </summary>
+		/// <returns>
+		/// 進捗の割合 [0.0, 1.0]。要求が無い場合は 1.0
+		/// </returns>
+		double ratio() const
+		{
+			return numRequested ? static_cast<double>(numCompleted + numFailed) / numRequested : 1.0;
+		}
+
+		/// <summary>
+		/// すべての要求が処理されたかを返します。
+		/// </summary>
+		/// <returns>
+		/// すべての要求が処理された場合 true, それ以外の場合は false
+		/// </returns>
+		bool isFinished() const
+		{
+			return (numCompleted + numFailed) == numRequested;
+		}
+	};
+
 	/// <summary>
 	/// アセットインタフェースクラス
 	/// </summary>
@@ -64,11 +117,29 @@ namespace s3d
 		/// <summary>
 		/// アセットのプリロード時に呼ばれる関数
 		/// </summary>
+		/// <remarks>
+		/// 非同期プリロードでは decode() の後にメインスレッドで呼ばれます。
+		/// </remarks>
 		/// <returns>
 		/// プリロードに成功した場合 true, それ以外の場合は false
 		/// </returns>
 		virtual bool preload() = 0;
 
+		/// <summary>
+		/// 非同期プリロード時にワーカースレッドで呼ばれる関数
+		/// </summary>
+		/// <remarks>
+		/// ファイルの読み込みやデコードなど、メインスレッド以外で実行できる処理を行います。
+		/// デフォルトでは何もせず、すべての処理は preload() で行われます。
+		/// </remarks>
+		/// <returns>
+		/// デコードに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		virtual bool decode()
+		{
+			return true;
+		}
+
 		/// <summary>
 		/// アセットの更新時に呼ばれる関数
 		/// </summary>
@@ -92,5 +163,83 @@ namespace s3d
 		/// アセットのタグ一覧
 		/// </returns>
 		virtual const Array<AssetTag>& getTags() const = 0;
+
+		/// <summary>
+		/// アセットが使用しているメモリの量を返します。
+		/// </summary>
+		/// <remarks>
+		/// メモリ予算の計算に使われます。デフォルトでは 0 を返し、自動的にリリースされません。
+		/// </remarks>
+		/// <returns>
+		/// 使用しているメモリの量（バイト）
+		/// </returns>
+		virtual size_t memoryUsage() const
+		{
+			return 0;
+		}
 	};
+
+	namespace Asset
+	{
+		/// <summary>
+		/// すべての種類のアセットの非同期プリロードの進捗を返します。
+		/// </summary>
+		/// <returns>
+		/// 非同期プリロードの進捗
+		/// </returns>
+		AssetLoadProgress GetLoadProgress();
+
+		/// <summary>
+		/// 指定したタグを持つアセットの非同期プリロードの進捗を返します。
+		/// </summary>
+		/// <param name="tag">
+		/// アセットのタグ
+		/// </param>
+		/// <returns>
+		/// 非同期プリロードの進捗
+		/// </returns>
+		AssetLoadProgress GetLoadProgressByTag(const AssetTag& tag);
+
+		/// <summary>
+		/// 1 フレームあたりのアップロード処理に使う時間の上限を設定します。
+		/// </summary>
+		/// <param name="milliseconds">
+		/// 時間の上限（ミリ秒）
+		/// </param>
+		/// <remarks>
+		/// デコードが終わったアセットは System::Update() の中で、上限を超えるまで優先度の高い順にアップロードされます。
+		/// 少なくとも 1 つのアセットは毎フレームアップロードされます。デフォルトは 4 ミリ秒です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void SetUploadTimeBudget(double milliseconds);
+
+		/// <summary>
+		/// 1 フレームあたりのアップロード処理に使う時間の上限を返します。
+		/// </summary>
+		/// <returns>
+		/// 時間の上限（ミリ秒）
+		/// </returns>
+		double GetUploadTimeBudget();
+
+		/// <summary>
+		/// すべての非同期プリロードが終わるまで待機します。
+		/// </summary>
+		/// <remarks>
+		/// メインスレッドから呼ぶ必要があります。待機中はアップロードが時間の上限なしで行われます。
+		/// </remarks>
+		/// <returns>
+		/// すべてのプリロードに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool WaitForLoad();
+
+		/// <summary>
+		/// まだデコードが始まっていない非同期プリロードの要求を取り消します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void CancelLoad();
+	}
 }
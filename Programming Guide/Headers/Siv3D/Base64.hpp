@@ -18,6 +18,7 @@ namespace s3d
 	/// </summary>
 	/// <remarks>
 	/// Base64 エンコード/デコードの機能を提供します。
+	/// CPU が対応している場合、エンコードとデコードは AVX2 または SSSE3 命令で 24 / 12 バイト単位で処理されます。
 	/// </remarks>
 	namespace Base64
 	{
@@ -56,6 +57,149 @@ namespace s3d
 		/// デコードされたバイナリデータ、デコードに失敗した場合空のバイナリデータ
 		/// </returns>
 		ByteArray Decode(const String& src);
+
+		/// <summary>
+		/// Base64 エンコードした結果の文字数を返します。
+		/// </summary>
+		/// <param name="size">
+		/// エンコードするデータのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// エンコードした結果の文字数
+		/// </returns>
+		constexpr size_t EncodedLength(size_t size)
+		{
+			return (size + 2) / 3 * 4;
+		}
+
+		/// <summary>
+		/// Base64 デコードした結果の最大のサイズを返します。
+		/// </summary>
+		/// <param name="length">
+		/// デコードするテキストの文字数
+		/// </param>
+		/// <returns>
+		/// デコードした結果の最大のサイズ（バイト）
+		/// </returns>
+		constexpr size_t MaxDecodedSize(size_t length)
+		{
+			return (length + 3) / 4 * 3;
+		}
+
+		/// <summary>
+		/// データを Base64 エンコードして、指定したバッファに書き込みます。
+		/// </summary>
+		/// <param name="data">
+		/// エンコードするデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// エンコードするデータのサイズ（バイト）
+		/// </param>
+		/// <param name="dst">
+		/// 書き込み先。EncodedLength(size) 文字以上の大きさが必要です
+		/// </param>
+		/// <remarks>
+		/// メモリの確保は行いません。終端の null 文字は書き込みません。
+		/// </remarks>
+		/// <returns>
+		/// 書き込んだ文字数
+		/// </returns>
+		size_t Encode(_In_reads_bytes_(size) const void* data, size_t size, _Out_writes_(EncodedLength(size)) char* dst);
+
+		/// <summary>
+		/// データを Base64 エンコードして、指定したバッファに書き込みます。
+		/// </summary>
+		/// <param name="data">
+		/// エンコードするデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// エンコードするデータのサイズ（バイト）
+		/// </param>
+		/// <param name="dst">
+		/// 書き込み先。EncodedLength(size) 文字以上の大きさが必要です
+		/// </param>
+		/// <remarks>
+		/// メモリの確保は行いません。終端の null 文字は書き込みません。
+		/// </remarks>
+		/// <returns>
+		/// 書き込んだ文字数
+		/// </returns>
+		size_t Encode(_In_reads_bytes_(size) const void* data, size_t size, _Out_writes_(EncodedLength(size)) wchar* dst);
+
+		/// <summary>
+		/// テキストを Base64 でデコードして、指定したバッファに書き込みます。
+		/// </summary>
+		/// <param name="src">
+		/// デコードするテキストの先頭ポインタ
+		/// </param>
+		/// <param name="length">
+		/// デコードするテキストの文字数
+		/// </param>
+		/// <param name="dst">
+		/// 書き込み先。MaxDecodedSize(length) バイト以上の大きさが必要です
+		/// </param>
+		/// <remarks>
+		/// メモリの確保は行いません。
+		/// </remarks>
+		/// <returns>
+		/// 書き込んだサイズ（バイト）。テキストが Base64 として正しくない場合は -1
+		/// </returns>
+		int64 Decode(_In_reads_(length) const char* src, size_t length, _Out_writes_bytes_(MaxDecodedSize(length)) void* dst);
+
+		/// <summary>
+		/// テキストを Base64 でデコードして、指定したバッファに書き込みます。
+		/// </summary>
+		/// <param name="src">
+		/// デコードするテキストの先頭ポインタ
+		/// </param>
+		/// <param name="length">
+		/// デコードするテキストの文字数
+		/// </param>
+		/// <param name="dst">
+		/// 書き込み先。MaxDecodedSize(length) バイト以上の大きさが必要です
+		/// </param>
+		/// <remarks>
+		/// メモリの確保は行いません。
+		/// </remarks>
+		/// <returns>
+		/// 書き込んだサイズ（バイト）。テキストが Base64 として正しくない場合は -1
+		/// </returns>
+		int64 Decode(_In_reads_(length) const wchar* src, size_t length, _Out_writes_bytes_(MaxDecodedSize(length)) void* dst);
+
+		/// <summary>
+		/// Reader の現在の位置から最後までのデータを Base64 エンコードし、ASCII テキストとして Writer に書き出します。
+		/// </summary>
+		/// <param name="reader">
+		/// エンコードするデータの Reader
+		/// </param>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <remarks>
+		/// 一定のサイズのバッファを使って少しずつ処理するため、データ全体をメモリ上に置く必要はありません。
+		/// </remarks>
+		/// <returns>
+		/// エンコードに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool Encode(IReader& reader, IWriter& writer);
+
+		/// <summary>
+		/// Reader の現在の位置から最後までの ASCII テキストを Base64 でデコードし、Writer に書き出します。
+		/// </summary>
+		/// <param name="reader">
+		/// デコードするテキストの Reader
+		/// </param>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <remarks>
+		/// 一定のサイズのバッファを使って少しずつ処理するため、データ全体をメモリ上に置く必要はありません。
+		/// テキスト中の改行と空白は無視されます。
+		/// </remarks>
+		/// <returns>
+		/// デコードに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool Decode(IReader& reader, IWriter& writer);
 	};
 }
 
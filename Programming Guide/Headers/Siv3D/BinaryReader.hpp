@@ -171,6 +171,36 @@ namespace s3d
 			return IReader::read(to);
 		}
 
+		/// <summary>
+		/// 位置を指定したスレッドセーフなデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		_Check_return_
+		bool supportsPositionalRead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を使わずに、ファイルの指定した位置からデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// ファイルポインタを共有しない OS の位置指定読み込み（pread / OVERLAPPED 付きの ReadFile）を使うため、複数のスレッドから同時に呼ぶことができます。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 readAt(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
 		/// <summary>
 		/// 読み込み位置を変更しないデータ読み込みをサポートしているかを返します。
 		/// </summary>
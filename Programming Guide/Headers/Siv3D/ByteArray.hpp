@@ -35,6 +35,15 @@ namespace s3d
 		/// </summary>
 		ByteArray();
 
+		/// <summary>
+		/// ファイルの内容をコピーして読み込み用バッファを作成します。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <remarks>
+		/// ファイル全体をメモリに読み込みます。コピーが不要な場合は MappedFileReader を使用してください。
+		/// </remarks>
 		explicit ByteArray(const FilePath& path);
 
 		/// <summary>
@@ -171,7 +180,7 @@ namespace s3d
 		/// <returns>
 		/// 読み込みバッファの先頭ポインタ
 		/// </returns>
-		const uint8* data() const;
+		const uint8* data() const override;
 
 		/// <summary>
 		/// 読み込みバッファの参照を返します。
@@ -232,6 +241,34 @@ namespace s3d
 			return IReader::read(to);
 		}
 
+		/// <summary>
+		/// 位置を指定したスレッドセーフなデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		bool supportsPositionalRead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を使わずに、バッファの指定した位置からデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 複数のスレッドから同時に呼ぶことができます。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 readAt(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
 		/// <summary>
 		/// 読み込み位置を変更しないデータ読み込みをサポートしているかを返します。
 		/// </summary>
@@ -21,6 +21,9 @@ namespace s3d
 	/// <summary>
 	/// CSV ファイルの読み込み
 	/// </summary>
+	/// <remarks>
+	/// 大きな CSV ファイルを読み込む場合は、フィールドの位置だけを保持する MappedCSVReader が高速です。
+	/// </remarks>
 	class CSVReader
 	{
 	private:
@@ -44,7 +47,14 @@ namespace s3d
 		/// <param name="path">
 		/// ファイルパス
 		/// </param>
-		explicit CSVReader(const FilePath& path);
+		/// <param name="numThreads">
+		/// 解析に使うスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// numThreads が 2 以上の場合、ファイルを引用符内の改行を考慮したレコードの境界で分割し、各部分を並列に解析してから行の一覧を結合します。
+		/// 結果は 1 スレッドで解析した場合と同じです。
+		/// </remarks>
+		explicit CSVReader(const FilePath& path, uint32 numThreads = 1);
 
 		/// <summary>
 		/// CSV ファイルを開きます。
@@ -78,10 +88,17 @@ namespace s3d
 		/// <param name="path">
 		/// ファイルパス
 		/// </param>
+		/// <param name="numThreads">
+		/// 解析に使うスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// numThreads が 2 以上の場合、ファイルを引用符内の改行を考慮したレコードの境界で分割し、各部分を並列に解析してから行の一覧を結合します。
+		/// 結果は 1 スレッドで解析した場合と同じです。
+		/// </remarks>
 		/// <returns>
 		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
 		/// </returns>
-		bool open(const FilePath& path);
+		bool open(const FilePath& path, uint32 numThreads = 1);
 
 		/// <summary>
 		/// CSV ファイルを開きます。
@@ -139,6 +156,9 @@ namespace s3d
 		/// <summary>
 		/// CSV ファイルが変更された場合、データの内容を更新します。
 		/// </summary>
+		/// <remarks>
+		/// open() で指定したスレッド数で解析します。
+		/// </remarks>
 		/// <returns>
 		/// 更新に成功した場合 true, それ以外の場合は false
 		/// </returns>
@@ -9,8 +9,11 @@
 //-----------------------------------------------
 
 # pragma once
+# include <memory>
 # include "Fwd.hpp"
 # include "ByteArray.hpp"
+# include "IReader.hpp"
+# include "IWriter.hpp"
 
 namespace s3d
 {
@@ -29,5 +32,745 @@ namespace s3d
 		{
 			return Decompress(data.data(), static_cast<size_t>(data.size()));
 		}
+
+		/// <summary>
+		/// ファイルを圧縮して保存します。
+		/// </summary>
+		/// <param name="from">
+		/// 圧縮するファイルのパス
+		/// </param>
+		/// <param name="to">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <remarks>
+		/// Compressor を使ってファイルを少しずつ読み込んで圧縮するため、ファイルのサイズによらず一定のメモリで処理します。
+		/// </remarks>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool CompressFile(const FilePath& from, const FilePath& to, _Field_range_(1, 9) int32 level = 7);
+
+		/// <summary>
+		/// 圧縮されたファイルを展開して保存します。
+		/// </summary>
+		/// <param name="from">
+		/// 展開するファイルのパス
+		/// </param>
+		/// <param name="to">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <remarks>
+		/// Decompressor を使ってファイルを少しずつ読み込んで展開するため、ファイルのサイズによらず一定のメモリで処理します。
+		/// </remarks>
+		/// <returns>
+		/// 展開に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool DecompressFile(const FilePath& from, const FilePath& to);
+
+		/// <summary>
+		/// データを独立したブロックに分割し、複数のスレッドで圧縮します。
+		/// </summary>
+		/// <param name="data">
+		/// 圧縮するデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// 圧縮するデータのサイズ（バイト）
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="blockSize">
+		/// 圧縮前のブロックのサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 各ブロックは Threading の共有スレッドプールで並列に圧縮され、末尾にブロックの位置の索引が書き込まれます。
+		/// BlockDecompressor を使うと、任意の範囲を、その範囲と重なるブロックだけを展開して読み込めます。
+		/// Decompress() でも全体を展開できます。その場合もブロックは並列に展開されます。
+		/// ブロックが小さいほどランダムアクセスは速くなり、圧縮率は下がります。
+		/// </remarks>
+		/// <returns>
+		/// 圧縮されたデータ
+		/// </returns>
+		ByteArray CompressBlocks(const void* data, size_t size, _Field_range_(1, 9) int32 level = 7, size_t blockSize = 1024 * 1024);
+
+		/// <summary>
+		/// データを独立したブロックに分割し、複数のスレッドで圧縮します。
+		/// </summary>
+		/// <param name="data">
+		/// 圧縮するデータ
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="blockSize">
+		/// 圧縮前のブロックのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 圧縮されたデータ
+		/// </returns>
+		inline ByteArray CompressBlocks(const ByteArray& data, _Field_range_(1, 9) int32 level = 7, size_t blockSize = 1024 * 1024)
+		{
+			return CompressBlocks(data.data(), static_cast<size_t>(data.size()), level, blockSize);
+		}
+
+		/// <summary>
+		/// ファイルを独立したブロックに分割し、複数のスレッドで圧縮して保存します。
+		/// </summary>
+		/// <param name="from">
+		/// 圧縮するファイルのパス
+		/// </param>
+		/// <param name="to">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="blockSize">
+		/// 圧縮前のブロックのサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 同時に読み込むのはスレッド数の 2 倍のブロックまでなので、ファイルのサイズによらず一定のメモリで処理します。
+		/// </remarks>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool CompressFileBlocks(const FilePath& from, const FilePath& to, _Field_range_(1, 9) int32 level = 7, size_t blockSize = 1024 * 1024);
 	}
+
+	/// <summary>
+	/// ストリーミング圧縮
+	/// </summary>
+	/// <remarks>
+	/// 書き込まれたデータを少しずつ圧縮して Writer に書き出します。
+	/// 内部のバッファは bufferSize で固定されるため、入力全体をメモリ上に置く必要はありません。
+	/// 出力は Compression::Decompress() や Decompressor で展開できます。
+	/// </remarks>
+	class Compressor
+	{
+	private:
+
+		class CCompressor;
+
+		std::shared_ptr<CCompressor> pImpl;
+
+	public:
+
+		/// <summary>
+		/// 内部バッファのデフォルトのサイズ（バイト）
+		/// </summary>
+		static constexpr size_t DefaultBufferSize = 128 * 1024;
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		Compressor();
+
+		/// <summary>
+		/// 圧縮したデータの書き出し先を指定して Compressor を作成します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		template <class Writer, class = std::enable_if_t<std::is_base_of<IWriter, Writer>::value>>
+		explicit Compressor(Writer&& writer, _Field_range_(1, 9) int32 level = 7, size_t bufferSize = DefaultBufferSize)
+			: Compressor()
+		{
+			open(std::move(writer), level, bufferSize);
+		}
+
+		/// <summary>
+		/// 圧縮したデータの書き出し先を指定して Compressor を作成します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		explicit Compressor(const std::shared_ptr<IWriter>& writer, _Field_range_(1, 9) int32 level = 7, size_t bufferSize = DefaultBufferSize);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		/// <remarks>
+		/// finish() が呼ばれていない場合は呼び出します。
+		/// </remarks>
+		~Compressor();
+
+		template <class Writer, class = std::enable_if_t<std::is_base_of<IWriter, Writer>::value>>
+		bool open(Writer&& writer, _Field_range_(1, 9) int32 level = 7, size_t bufferSize = DefaultBufferSize)
+		{
+			return open(std::make_shared<Writer>(std::move(writer)), level, bufferSize);
+		}
+
+		/// <summary>
+		/// 圧縮したデータの書き出し先を設定します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="level">
+		/// 圧縮レベル [1, 9]
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 設定に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IWriter>& writer, _Field_range_(1, 9) int32 level = 7, size_t bufferSize = DefaultBufferSize);
+
+		/// <summary>
+		/// 圧縮を開始できるかを返します。
+		/// </summary>
+		/// <returns>
+		/// 書き出し先が設定されていて、finish() が呼ばれていない場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// 圧縮を開始できるかを返します。
+		/// </summary>
+		/// <returns>
+		/// 書き出し先が設定されていて、finish() が呼ばれていない場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// データを圧縮します。
+		/// </summary>
+		/// <param name="data">
+		/// 圧縮するデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// 圧縮するデータのサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 内部バッファがいっぱいになるたびに、圧縮したデータが Writer に書き出されます。
+		/// </remarks>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool write(_In_reads_bytes_(size) const void* data, size_t size);
+
+		/// <summary>
+		/// データを圧縮します。
+		/// </summary>
+		/// <param name="data">
+		/// 圧縮するデータ
+		/// </param>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool write(const ByteArray& data)
+		{
+			return write(data.data(), static_cast<size_t>(data.size()));
+		}
+
+		/// <summary>
+		/// Reader の現在の位置から最後までのデータを圧縮します。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮するデータの Reader
+		/// </param>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool write(IReader& reader);
+
+		/// <summary>
+		/// これまでに書き込まれたデータをすべて圧縮して Writer に書き出します。
+		/// </summary>
+		/// <remarks>
+		/// 書き出したところまでのデータは、その後のデータが無くても展開できます。頻繁に呼ぶと圧縮率が下がります。
+		/// </remarks>
+		/// <returns>
+		/// 書き出しに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool flush();
+
+		/// <summary>
+		/// 圧縮を終了し、残りのデータと終端を Writer に書き出します。
+		/// </summary>
+		/// <returns>
+		/// 書き出しに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool finish();
+
+		/// <summary>
+		/// これまでに書き込まれたデータのサイズ（バイト）を返します。
+		/// </summary>
+		/// <returns>
+		/// 書き込まれたデータのサイズ（バイト）
+		/// </returns>
+		int64 inputSize() const;
+
+		/// <summary>
+		/// これまでに Writer に書き出した圧縮データのサイズ（バイト）を返します。
+		/// </summary>
+		/// <returns>
+		/// 書き出した圧縮データのサイズ（バイト）
+		/// </returns>
+		int64 outputSize() const;
+	};
+
+	/// <summary>
+	/// ストリーミング展開
+	/// </summary>
+	/// <remarks>
+	/// Reader から圧縮されたデータを少しずつ読み込み、展開したデータを返します。
+	/// 内部のバッファは bufferSize で固定されるため、展開後のデータ全体をメモリ上に置く必要はありません。
+	/// </remarks>
+	class Decompressor
+	{
+	private:
+
+		class CDecompressor;
+
+		std::shared_ptr<CDecompressor> pImpl;
+
+	public:
+
+		/// <summary>
+		/// 内部バッファのデフォルトのサイズ（バイト）
+		/// </summary>
+		static constexpr size_t DefaultBufferSize = 128 * 1024;
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		Decompressor();
+
+		/// <summary>
+		/// 圧縮されたデータの読み込み元を指定して Decompressor を作成します。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		explicit Decompressor(Reader&& reader, size_t bufferSize = DefaultBufferSize)
+			: Decompressor()
+		{
+			open(std::move(reader), bufferSize);
+		}
+
+		/// <summary>
+		/// 圧縮されたデータの読み込み元を指定して Decompressor を作成します。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		explicit Decompressor(const std::shared_ptr<IReader>& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		~Decompressor();
+
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		bool open(Reader&& reader, size_t bufferSize = DefaultBufferSize)
+		{
+			return open(std::make_shared<Reader>(std::move(reader)), bufferSize);
+		}
+
+		/// <summary>
+		/// 圧縮されたデータの読み込み元を設定します。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		/// <param name="bufferSize">
+		/// 内部バッファのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 設定に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IReader>& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// <summary>
+		/// 読み込み元が設定されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 読み込み元が設定されている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// 読み込み元が設定されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 読み込み元が設定されている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// データを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込む最大のサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）。データの終端に達した場合は 0, エラーの場合は -1
+		/// </returns>
+		int64 read(_Out_writes_bytes_(size) void* buffer, int64 size);
+
+		/// <summary>
+		/// 残りのデータをすべて展開して Writer に書き出します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <returns>
+		/// 展開に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool read(IWriter& writer);
+
+		/// <summary>
+		/// データの終端まで展開したかを返します。
+		/// </summary>
+		/// <returns>
+		/// データの終端まで展開した場合 true, それ以外の場合は false
+		/// </returns>
+		bool isFinished() const;
+
+		/// <summary>
+		/// これまでに Reader から読み込んだ圧縮データのサイズ（バイト）を返します。
+		/// </summary>
+		/// <returns>
+		/// 読み込んだ圧縮データのサイズ（バイト）
+		/// </returns>
+		int64 inputSize() const;
+
+		/// <summary>
+		/// これまでに展開したデータのサイズ（バイト）を返します。
+		/// </summary>
+		/// <returns>
+		/// 展開したデータのサイズ（バイト）
+		/// </returns>
+		int64 outputSize() const;
+	};
+
+	/// <summary>
+	/// ブロック単位で圧縮されたデータのランダムアクセス
+	/// </summary>
+	/// <remarks>
+	/// Compression::CompressBlocks() で圧縮されたデータを、展開後の位置を指定して読み込みます。
+	/// オープン時に末尾の索引だけを読み込み、読み込む範囲と重なるブロックだけを展開します。
+	/// 最近展開したブロックはキャッシュされます。
+	/// </remarks>
+	class BlockDecompressor : public IReader
+	{
+	private:
+
+		class CBlockDecompressor;
+
+		std::shared_ptr<CBlockDecompressor> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		BlockDecompressor();
+
+		/// <summary>
+		/// ブロック単位で圧縮されたファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		explicit BlockDecompressor(const FilePath& path);
+
+		/// <summary>
+		/// ブロック単位で圧縮されたデータを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		explicit BlockDecompressor(Reader&& reader)
+			: BlockDecompressor()
+		{
+			open(std::move(reader));
+		}
+
+		/// <summary>
+		/// ブロック単位で圧縮されたデータを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		explicit BlockDecompressor(const std::shared_ptr<IReader>& reader);
+
+		// デストラクタがあるため暗黙のムーブコンストラクタは作られず、
+		// BlockDecompressor の右辺値が Reader&& のコンストラクタに一致して open() と無限に再帰するのを防ぐ
+		BlockDecompressor(const BlockDecompressor&) = default;
+
+		BlockDecompressor(BlockDecompressor&&) = default;
+
+		BlockDecompressor& operator = (const BlockDecompressor&) = default;
+
+		BlockDecompressor& operator = (BlockDecompressor&&) = default;
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		~BlockDecompressor();
+
+		/// <summary>
+		/// ブロック単位で圧縮されたファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path);
+
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		bool open(Reader&& reader)
+		{
+			return open(std::make_shared<Reader>(std::move(reader)));
+		}
+
+		/// <summary>
+		/// ブロック単位で圧縮されたデータを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの Reader
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IReader>& reader);
+
+		/// <summary>
+		/// データを閉じます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// データがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// データがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const override;
+
+		/// <summary>
+		/// データがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// データがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// 展開後のデータのサイズを返します。
+		/// </summary>
+		/// <returns>
+		/// 展開後のデータのサイズ（バイト）
+		/// </returns>
+		int64 size() const override;
+
+		/// <summary>
+		/// ブロックの数を返します。
+		/// </summary>
+		/// <returns>
+		/// ブロックの数
+		/// </returns>
+		size_t num_blocks() const;
+
+		/// <summary>
+		/// 圧縮前のブロックのサイズを返します。
+		/// </summary>
+		/// <returns>
+		/// 圧縮前のブロックのサイズ（バイト）
+		/// </returns>
+		size_t blockSize() const;
+
+		/// <summary>
+		/// 展開したブロックをキャッシュする数を設定します。
+		/// </summary>
+		/// <param name="numBlocks">
+		/// キャッシュするブロックの数
+		/// </param>
+		/// <remarks>
+		/// デフォルトは 4 です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setCacheSize(size_t numBlocks);
+
+		/// <summary>
+		/// 展開後のデータの現在の読み込み位置を返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の読み込み位置（バイト）
+		/// </returns>
+		int64 getPos() const override;
+
+		/// <summary>
+		/// 展開後のデータの読み込み位置を変更します。
+		/// </summary>
+		/// <param name="pos">
+		/// 新しい読み込み位置（バイト）
+		/// </param>
+		/// <remarks>
+		/// ブロックの展開は行われません。
+		/// </remarks>
+		/// <returns>
+		/// 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool setPos(int64 pos) override;
+
+		/// <summary>
+		/// データを読み飛ばし、読み込み位置を変更します。
+		/// </summary>
+		/// <param name="offset">
+		/// 読み飛ばすサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 新しい読み込み位置（バイト）
+		/// </returns>
+		int64 skip(int64 offset) override;
+
+		/// <summary>
+		/// 現在の読み込み位置からデータを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 size) override;
+
+		/// <summary>
+		/// 指定した位置からデータを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 範囲が複数のブロックにまたがる場合、ブロックは並列に展開されます。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) override;
+
+		/// <summary>
+		/// 位置を指定したスレッドセーフなデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 元の Reader が位置を指定した読み込みをサポートしている場合 true, それ以外の場合は false
+		/// </returns>
+		bool supportsPositionalRead() const override;
+
+		/// <summary>
+		/// 読み込み位置を使わずに、指定した位置からデータを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 readAt(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		bool supportsLookahead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を変更しないでデータを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないでデータを展開して読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
+		/// <summary>
+		/// 範囲を指定してデータを展開し、ByteArray として返します。
+		/// </summary>
+		/// <param name="pos">
+		/// 展開後のデータの先頭から数えた開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 展開するサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 展開したデータ
+		/// </returns>
+		ByteArray readSubset(int64 pos, int64 size) const;
+	};
 }
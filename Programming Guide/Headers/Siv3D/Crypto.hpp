@@ -9,10 +9,13 @@
 //-----------------------------------------------
 
 # pragma once
+# include <memory>
 # include "Fwd.hpp"
 # include "Array.hpp"
 # include "String.hpp"
 # include "ByteArray.hpp"
+# include "IReader.hpp"
+# include "IWriter.hpp"
 
 namespace s3d
 {
@@ -526,5 +529,317 @@ namespace s3d
 		//	暗号化データファイル -> オリジナルデータファイル
 		//
 		bool DecryptFile(const FilePath& from, const FilePath& to, const AES128Key& key, const AESIV& iv = AESIV::Default(), bool md5Check = true);
+
+		/// <summary>
+		/// AES の計算に CPU の AES-NI 命令が使われるかを返します。
+		/// </summary>
+		/// <returns>
+		/// AES-NI 命令が使われる場合 true, それ以外の場合は false
+		/// </returns>
+		bool IsHardwareAccelerated();
+
+		//////////////////////////////////////////////////////
+		//
+		//	AES-CTR 暗号化・復号 (ポインタ -> ポインタ)
+		//
+		//	ブロックを Threading の共有スレッドプールで並列に処理し、AES-NI 命令が使える場合はそれを使います。
+		//	CTR モードは暗号化と復号が同じ処理です。offset には src の先頭がデータ全体の何バイト目かを指定し、任意の位置から処理できます。
+		//	src と dst は同じでも構いません。改ざんの検出は行いません。
+		//
+		void TransformCTR(const void* src, void* dst, size_t size, const AES128Key& key, const AESIV& iv, uint64 offset = 0);
+
+		//////////////////////////////////////////////////////
+		//
+		//	オリジナルデータ(ポインタ) -> 暗号化データ (AES-CTR)
+		//
+		ByteArray EncryptCTR(const void* src, size_t srcSize, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	オリジナルデータ(ByteArray) -> 暗号化データ (AES-CTR)
+		//
+		inline ByteArray EncryptCTR(const ByteArray& src, const AES128Key& key, const AESIV& iv)
+		{
+			return EncryptCTR(src.data(), static_cast<size_t>(src.size()), key, iv);
+		}
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データ(ポインタ) -> オリジナルデータ(ByteArray) (AES-CTR)
+		//
+		ByteArray DecryptCTR(const void* src, size_t srcSize, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データ(ByteArray) -> オリジナルデータ(ByteArray) (AES-CTR)
+		//
+		inline ByteArray DecryptCTR(const ByteArray& src, const AES128Key& key, const AESIV& iv)
+		{
+			return DecryptCTR(src.data(), static_cast<size_t>(src.size()), key, iv);
+		}
+
+		//////////////////////////////////////////////////////
+		//
+		//	オリジナルデータ(ポインタ) -> 暗号化データ (AES-GCM)
+		//
+		//	iv の先頭 12 バイトを nonce として使い、暗号化データの末尾に 16 バイトの認証タグを付加します。
+		//	同じ鍵で同じ iv を 2 回以上使ってはいけません。
+		//	暗号化と認証タグの計算は、ブロックを Threading の共有スレッドプールで並列に処理します。
+		//
+		ByteArray EncryptGCM(const void* src, size_t srcSize, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	オリジナルデータ(ByteArray) -> 暗号化データ (AES-GCM)
+		//
+		inline ByteArray EncryptGCM(const ByteArray& src, const AES128Key& key, const AESIV& iv)
+		{
+			return EncryptGCM(src.data(), static_cast<size_t>(src.size()), key, iv);
+		}
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データ(ポインタ) -> オリジナルデータ(ByteArray) (AES-GCM)
+		//
+		//	認証タグが一致しない場合は none を返します。
+		//
+		Optional<ByteArray> DecryptGCM(const void* src, size_t srcSize, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データ(ByteArray) -> オリジナルデータ(ByteArray) (AES-GCM)
+		//
+		inline Optional<ByteArray> DecryptGCM(const ByteArray& src, const AES128Key& key, const AESIV& iv)
+		{
+			return DecryptGCM(src.data(), static_cast<size_t>(src.size()), key, iv);
+		}
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データ(ポインタ) -> オリジナルデータ(ポインタ) (AES-GCM)
+		//
+		//	dstSize は srcSize - 16 である必要があります。認証タグが一致しない場合は false を返し、dst の内容は不定です。
+		//
+		bool DecryptGCM(const void* src, size_t srcSize, void* dst, size_t dstSize, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	オリジナルデータファイル -> 暗号化データファイル (AES-GCM)
+		//
+		bool EncryptFileGCM(const FilePath& from, const FilePath& to, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データファイル -> オリジナルデータ(ByteArray) (AES-GCM)
+		//
+		//	ファイルをメモリマップして、読み込みと復号を並列に行います。
+		//
+		Optional<ByteArray> DecryptFileGCM(const FilePath& from, const AES128Key& key, const AESIV& iv);
+
+		//////////////////////////////////////////////////////
+		//
+		//	暗号化データファイル -> オリジナルデータファイル (AES-GCM)
+		//
+		//	認証タグが一致しない場合は to を作成しません。
+		//
+		bool DecryptFileGCM(const FilePath& from, const FilePath& to, const AES128Key& key, const AESIV& iv);
 	}
+
+	/// <summary>
+	/// AES-CTR で暗号化されたデータを復号しながら読み込む Reader
+	/// </summary>
+	/// <remarks>
+	/// CTR モードは任意の位置から復号できるため、読み込み位置の変更や位置を指定した読み込みも、必要な部分だけを復号します。
+	/// 改ざんの検出は行いません。
+	/// </remarks>
+	class AESCTRReader : public IReader
+	{
+	private:
+
+		class CAESCTRReader;
+
+		std::shared_ptr<CAESCTRReader> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		AESCTRReader();
+
+		/// <summary>
+		/// 暗号化されたデータの Reader を指定して AESCTRReader を作成します。
+		/// </summary>
+		/// <param name="reader">
+		/// 暗号化されたデータの Reader
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		explicit AESCTRReader(Reader&& reader, const AES128Key& key, const AESIV& iv)
+			: AESCTRReader()
+		{
+			open(std::move(reader), key, iv);
+		}
+
+		/// <summary>
+		/// 暗号化されたデータの Reader を指定して AESCTRReader を作成します。
+		/// </summary>
+		/// <param name="reader">
+		/// 暗号化されたデータの Reader
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		explicit AESCTRReader(const std::shared_ptr<IReader>& reader, const AES128Key& key, const AESIV& iv);
+
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		bool open(Reader&& reader, const AES128Key& key, const AESIV& iv)
+		{
+			return open(std::make_shared<Reader>(std::move(reader)), key, iv);
+		}
+
+		/// <summary>
+		/// 暗号化されたデータの Reader を設定します。
+		/// </summary>
+		/// <param name="reader">
+		/// 暗号化されたデータの Reader
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		/// <returns>
+		/// 設定に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IReader>& reader, const AES128Key& key, const AESIV& iv);
+
+		bool isOpened() const override;
+
+		explicit operator bool() const { return isOpened(); }
+
+		int64 size() const override;
+
+		int64 getPos() const override;
+
+		bool setPos(int64 pos) override;
+
+		int64 skip(int64 offset) override;
+
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 size) override;
+
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) override;
+
+		bool supportsPositionalRead() const override;
+
+		int64 readAt(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
+		bool supportsLookahead() const override;
+
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 size) const override;
+
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+	};
+
+	/// <summary>
+	/// 書き込まれたデータを AES-CTR で暗号化して書き出す Writer
+	/// </summary>
+	/// <remarks>
+	/// 書き込み位置に応じたカウンタで暗号化されるため、書き込み位置を変更して上書きすることもできます。
+	/// 出力は AESCTRReader や Crypto2::DecryptCTR() で復号できます。
+	/// </remarks>
+	class AESCTRWriter : public IWriter
+	{
+	private:
+
+		class CAESCTRWriter;
+
+		std::shared_ptr<CAESCTRWriter> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		AESCTRWriter();
+
+		/// <summary>
+		/// 暗号化したデータの書き出し先を指定して AESCTRWriter を作成します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		template <class Writer, class = std::enable_if_t<std::is_base_of<IWriter, Writer>::value>>
+		explicit AESCTRWriter(Writer&& writer, const AES128Key& key, const AESIV& iv)
+			: AESCTRWriter()
+		{
+			open(std::move(writer), key, iv);
+		}
+
+		/// <summary>
+		/// 暗号化したデータの書き出し先を指定して AESCTRWriter を作成します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		explicit AESCTRWriter(const std::shared_ptr<IWriter>& writer, const AES128Key& key, const AESIV& iv);
+
+		template <class Writer, class = std::enable_if_t<std::is_base_of<IWriter, Writer>::value>>
+		bool open(Writer&& writer, const AES128Key& key, const AESIV& iv)
+		{
+			return open(std::make_shared<Writer>(std::move(writer)), key, iv);
+		}
+
+		/// <summary>
+		/// 暗号化したデータの書き出し先を設定します。
+		/// </summary>
+		/// <param name="writer">
+		/// 書き出し先の Writer
+		/// </param>
+		/// <param name="key">
+		/// AES-128 暗号鍵
+		/// </param>
+		/// <param name="iv">
+		/// AES-128 初期化ベクトル
+		/// </param>
+		/// <returns>
+		/// 設定に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IWriter>& writer, const AES128Key& key, const AESIV& iv);
+
+		bool isOpened() const override;
+
+		explicit operator bool() const { return isOpened(); }
+
+		int64 size() const override;
+
+		int64 getPos() const override;
+
+		bool setPos(int64 pos) override;
+
+		size_t write(_In_reads_bytes_(size) const void* buffer, size_t size) override;
+
+		using IWriter::write;
+	};
 }
@@ -10,13 +10,63 @@
 
 # pragma once
 # include <memory>
+# include <functional>
 # include "Fwd.hpp"
 # include "Array.hpp"
 # include "String.hpp"
+# include "Optional.hpp"
+# include "MD5.hpp"
 # include "ArchivedFileReader.hpp"
 
 namespace s3d
 {
+	/// <summary>
+	/// ファイルアーカイブの作成設定
+	/// </summary>
+	struct ArchiveOption
+	{
+		/// <summary>
+		/// 圧縮レベル [1, 9]。0 の場合は圧縮しない
+		/// </summary>
+		int32 compressionLevel = 7;
+
+		/// <summary>
+		/// ファイルごとの圧縮レベルを返す関数
+		/// </summary>
+		/// <remarks>
+		/// アーカイブ化するディレクトリからの相対パスを受け取り、圧縮レベル [0, 9] を返します。負の値を返した場合は compressionLevel が使われます。
+		/// nullptr の場合はすべてのファイルに compressionLevel が使われます。
+		/// </remarks>
+		std::function<int32(const FilePath&)> levelOf;
+
+		/// <summary>
+		/// 圧縮せずに格納するファイルの拡張子
+		/// </summary>
+		/// <remarks>
+		/// すでに圧縮されているフォーマットは、圧縮してもサイズがほとんど変わらないため、圧縮を試みずに格納します。
+		/// </remarks>
+		Array<String> storedExtensions = { L"png", L"jpg", L"jpeg", L"gif", L"webp", L"ogg", L"mp3", L"m4a", L"aac", L"opus", L"mp4", L"zip" };
+
+		/// <summary>
+		/// 圧縮後のサイズが元のサイズのこの割合を超える場合は、圧縮せずに格納する
+		/// </summary>
+		double maxCompressionRatio = 0.95;
+
+		/// <summary>
+		/// 圧縮に使うスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </summary>
+		uint32 numThreads = 0;
+
+		/// <summary>
+		/// 出力先に既存のアーカイブがある場合、内容のハッシュと実効的な圧縮レベルが変わっていないファイルの圧縮済みデータを再利用する
+		/// </summary>
+		/// <remarks>
+		/// 実効的な圧縮レベルは compressionLevel, levelOf, storedExtensions を適用した後の値で、目次に記録されます。
+		/// これらを変更したファイルは圧縮し直されます。maxCompressionRatio の変更を既存のファイルに反映するには false にしてください。
+		/// </remarks>
+		bool incremental = true;
+	};
+
 	/// <summary>
 	/// アーカイブ
 	/// </summary>
@@ -34,15 +84,102 @@ namespace s3d
 		/// <param name="to">
 		/// 保存するアーカイブファイル名
 		/// </param>
+		/// <remarks>
+		/// アーカイブの先頭には、パスの 64-bit ハッシュをキーとするオープンアドレス法（線形探索、負荷率 0.5 以下）の目次が書き込まれ、
+		/// 各エントリはファイルの位置とサイズ、パス文字列の位置、圧縮の有無を示すフラグと実効的な圧縮レベルを持ちます。
+		/// </remarks>
 		/// <returns>
 		/// ファイルアーカイブの作成に成功した場合 true, それ以外の場合は false
 		/// </returns>
 		bool Create(const FilePath& from, const FilePath& to);
+
+		/// <summary>
+		/// 設定を指定して、複数のスレッドでファイルアーカイブを作成します。
+		/// </summary>
+		/// <param name="from">
+		/// アーカイブ化するディレクトリ
+		/// </param>
+		/// <param name="to">
+		/// 保存するアーカイブファイル名
+		/// </param>
+		/// <param name="option">
+		/// ファイルアーカイブの作成設定
+		/// </param>
+		/// <remarks>
+		/// ファイルは Compression::Compress() で並列に圧縮され、スレッド数によらず常にパスの順に書き込まれるため、
+		/// 同じ入力からは同じアーカイブが作成されます。
+		/// 圧縮してもサイズが小さくならないファイルは圧縮せずに格納され、目次のエントリに圧縮の有無が記録されます。
+		/// 作成中のアーカイブは一時ファイルに書き込まれ、成功した場合のみ to に置き換えられます。
+		/// </remarks>
+		/// <returns>
+		/// ファイルアーカイブの作成に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool Create(const FilePath& from, const FilePath& to, const ArchiveOption& option);
 	}
 
+	/// <summary>
+	/// アーカイブされたファイルの情報
+	/// </summary>
+	struct ArchivedFileInfo
+	{
+		/// <summary>
+		/// アーカイブの先頭から数えた、格納されているデータの位置（バイト）
+		/// </summary>
+		int64 offset = 0;
+
+		/// <summary>
+		/// ファイルのサイズ（バイト）
+		/// </summary>
+		int64 size = 0;
+
+		/// <summary>
+		/// アーカイブに格納されているデータのサイズ（バイト）
+		/// </summary>
+		/// <remarks>
+		/// compressed が false の場合は size と同じです。
+		/// </remarks>
+		int64 storedSize = 0;
+
+		/// <summary>
+		/// 圧縮前のファイルの内容の MD5 ハッシュ値
+		/// </summary>
+		MD5Value hash = {};
+
+		/// <summary>
+		/// 作成時の実効的な圧縮レベル [0, 9]
+		/// </summary>
+		/// <remarks>
+		/// ArchiveOption の compressionLevel, levelOf, storedExtensions を適用した後の値です。0 の場合は圧縮を試みずに格納されています。
+		/// </remarks>
+		int32 level = 0;
+
+		/// <summary>
+		/// ファイルが圧縮されて格納されているか
+		/// </summary>
+		/// <remarks>
+		/// 目次のエントリに記録されたフラグです。サイズの比較からは判定しません。
+		/// </remarks>
+		bool compressed = false;
+
+		/// <summary>
+		/// ファイルが圧縮されて格納されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 圧縮されている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isCompressed() const
+		{
+			return compressed;
+		}
+	};
+
 	/// <summary>
 	/// ファイルアーカイブ
 	/// </summary>
+	/// <remarks>
+	/// オープン時に目次のハッシュテーブルを一度だけ読み込み、以降のファイルの検索は登録数によらず一定時間で行います。
+	/// 目次を持たない古い形式のアーカイブは、オープン時にハッシュテーブルを作成します。
+	/// </remarks>
 	class FileArchive
 	{
 	private:
@@ -109,10 +246,55 @@ namespace s3d
 		/// <summary>
 		/// アーカイブされたファイル名の一覧を返します。
 		/// </summary>
+		/// <remarks>
+		/// 一覧はオープン時に作成され、コピーされずに参照が返されます。
+		/// 参照は FileArchive が close() されるか破棄されるまで有効です。
+		/// </remarks>
+		/// <returns>
+		/// アーカイブされたファイル名の一覧
+		/// </returns>
+		const Array<FilePath>& contents() const &;
+
+		/// <summary>
+		/// アーカイブされたファイル名の一覧を返します。
+		/// </summary>
+		/// <remarks>
+		/// 一時オブジェクトに対して呼ばれた場合は、破棄された後も使えるよう一覧のコピーを返します。
+		/// </remarks>
 		/// <returns>
 		/// アーカイブされたファイル名の一覧
 		/// </returns>
-		Array<FilePath> contents() const;
+		Array<FilePath> contents() const &&;
+
+		/// <summary>
+		/// アーカイブされたファイルの数を返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブされたファイルの数
+		/// </returns>
+		size_t num_files() const;
+
+		/// <summary>
+		/// 指定したファイルがアーカイブされているかを返します。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブされたファイルのパス
+		/// </param>
+		/// <returns>
+		/// アーカイブされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool contains(const FilePath& path) const;
+
+		/// <summary>
+		/// アーカイブされたファイルの情報を返します。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブされたファイルのパス
+		/// </param>
+		/// <returns>
+		/// ファイルの情報。アーカイブされていない場合は none
+		/// </returns>
+		Optional<ArchivedFileInfo> getInfo(const FilePath& path) const;
 
 		/// <summary>
 		/// ファイルアーカイブがオープンされているかを返します。
@@ -128,11 +310,24 @@ namespace s3d
 		/// <param name="path">
 		/// アーカイブされたファイルのパス
 		/// </param>
+		/// <remarks>
+		/// ファイルは目次のハッシュテーブルから一定時間で検索されます。
+		/// 圧縮されているファイルは、展開したデータを読み込む ArchivedFileReader を返します。
+		/// </remarks>
 		/// <returns>
 		/// アーカイブされたファイルの ArchivedFileReader
 		/// </returns>
 		ArchivedFileReader load(const FilePath& path);
 
+		/// <summary>
+		/// アーカイブされたファイルを ByteArray としてロードします。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブされたファイルのパス
+		/// </param>
+		/// <returns>
+		/// アーカイブされたファイルの内容
+		/// </returns>
 		ByteArray loadByteArray(const FilePath& path) const;
 	};
 }
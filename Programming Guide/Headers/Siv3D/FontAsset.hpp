@@ -208,6 +208,67 @@ namespace s3d
 		/// </returns>
 		static bool PreloadAll();
 
+		/// <summary>
+		/// Font アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="name">
+		/// プリロードする Font アセットの名前
+		/// </param>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <remarks>
+		/// フォントの作成はデバイスを使うため、要求は優先度の順に System::Update() の中でメインスレッドで処理されます。
+		/// 同じ優先度の要求は、同じタグを持つアセットがまとめて処理されます。
+		/// 進捗は Asset::GetLoadProgress() で取得できます。
+		/// </remarks>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadAsync(const AssetName& name, int32 priority = 0);
+
+		/// <summary>
+		/// Font アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="tag">
+		/// プリロードする Font アセットのタグ
+		/// </param>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <remarks>
+		/// 進捗は Asset::GetLoadProgressByTag() で取得できます。
+		/// </remarks>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadByTagAsync(const AssetTag& tag, int32 priority = 0);
+
+		/// <summary>
+		/// 登録しているすべての Font アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadAllAsync(int32 priority = 0);
+
+		/// <summary>
+		/// Font アセットのプリロードが完了しているかを調べます。
+		/// </summary>
+		/// <param name="name">
+		/// Font アセットの名前
+		/// </param>
+		/// <remarks>
+		/// 非同期プリロードの途中のアセットにアクセスすると、メインスレッドでプリロードが完了するまで待機します。
+		/// </remarks>
+		/// <returns>
+		/// プリロードが完了している場合 true, それ以外の場合は false
+		/// </returns>
+		static bool IsReady(const AssetName& name);
+
 		/// <summary>
 		/// Font アセットをリリースします。
 		/// </summary>
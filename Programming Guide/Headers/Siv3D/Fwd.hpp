@@ -124,6 +124,12 @@ namespace s3d
 	//
 	class BinaryReader;
 
+	//////////////////////////////////////////////////////
+	//
+	//	MappedFileReader.hpp
+	//
+	class MappedFileReader;
+
 	//////////////////////////////////////////////////////
 	//
 	//	IWriter.hpp
@@ -159,6 +165,13 @@ namespace s3d
 	//	MD5.hpp
 	//
 	struct MD5Value;
+	class MD5Hasher;
+
+	//////////////////////////////////////////////////////
+	//
+	//	XXHash.hpp
+	//
+	class XXHash64Hasher;
 
 	//////////////////////////////////////////////////////
 	//
@@ -173,6 +186,16 @@ namespace s3d
 	//
 	union AES128Key;
 	union AESIV;
+	class AESCTRReader;
+	class AESCTRWriter;
+
+	//////////////////////////////////////////////////////
+	//
+	//	Compression.hpp
+	//
+	class Compressor;
+	class Decompressor;
+	class BlockDecompressor;
 
 	//////////////////////////////////////////////////////
 	//
@@ -184,6 +207,8 @@ namespace s3d
 	//
 	//	FileArchive.hpp
 	//
+	struct ArchiveOption;
+	struct ArchivedFileInfo;
 	class FileArchive;
 
 	//////////////////////////////////////////////////////
@@ -192,6 +217,12 @@ namespace s3d
 	//
 	class CSVReader;
 
+	//////////////////////////////////////////////////////
+	//
+	//	MappedCSVReader.hpp
+	//
+	class MappedCSVReader;
+
 	//////////////////////////////////////////////////////
 	//
 	//	CSVWriter.hpp
@@ -229,6 +260,14 @@ namespace s3d
 	//
 	class JSONReader;
 
+	//////////////////////////////////////////////////////
+	//
+	//	JSONPullReader.hpp
+	//
+	enum class JSONTokenType;
+	struct JSONToken;
+	class JSONPullReader;
+
 	//////////////////////////////////////////////////////
 	//
 	//	ZIPReader.hpp
@@ -450,6 +489,7 @@ namespace s3d
 	enum class Interpolation;
 	enum class FloodFillConnectivity;
 	enum class CascadeType;
+	enum class MipFilter;
 	class Image;
 	class ImageRegion;
 
@@ -482,6 +522,47 @@ namespace s3d
 	using ImageRG16F = CustomImage<RG16F>;
 	using ImageRG32F = CustomImage<RG32F>;
 
+	//////////////////////////////////////////////////////
+	//
+	//	ImageView.hpp
+	//
+	class ImageView;
+	class MutableImageView;
+
+	//////////////////////////////////////////////////////
+	//
+	//	ImagePipeline.hpp
+	//
+	class ImagePipeline;
+
+	//////////////////////////////////////////////////////
+	//
+	//	SummedAreaTable.hpp
+	//
+	template <class SumType> class SummedAreaTableBase;
+	using SummedAreaTable = SummedAreaTableBase<int64>;
+	using SummedAreaTableF = SummedAreaTableBase<double>;
+
+	//////////////////////////////////////////////////////
+	//
+	//	ImageDecoder.hpp
+	//
+	class ImageDecoder;
+
+	//////////////////////////////////////////////////////
+	//
+	//	TiledImage.hpp
+	//
+	class TiledImage;
+
+	//////////////////////////////////////////////////////
+	//
+	//	Threading.hpp
+	//
+	class ImageSaveQueue;
+	class CancellationToken;
+	template <class Type> class Task;
+
 	//////////////////////////////////////////////////////
 	//
 	//	QR.hpp
@@ -1135,6 +1216,7 @@ namespace s3d
 	//
 	using AssetName = String;
 	using AssetTag = String;
+	struct AssetLoadProgress;
 	class IAsset;
 
 	//////////////////////////////////////////////////////
@@ -141,6 +141,56 @@ namespace s3d
 		/// </returns>
 		virtual int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const = 0;
 
+		/// <summary>
+		/// 位置を指定したスレッドセーフなデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// readAt() をサポートしている場合 true, それ以外の場合は false
+		/// </returns>
+		virtual bool supportsPositionalRead() const
+		{
+			return false;
+		}
+
+		/// <summary>
+		/// 読み込み位置を使わずに、指定した位置からデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 現在の読み込み位置を参照も変更もしないため、複数のスレッドから同時に呼ぶことができます。
+		/// supportsPositionalRead() が false の Reader では何もせずに 0 を返します。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		virtual int64 readAt(void* /*buffer*/, int64 /*pos*/, int64 /*size*/) const
+		{
+			return 0;
+		}
+
+		/// <summary>
+		/// Reader の内容がメモリ上に連続して存在する場合、その先頭ポインタを返します。
+		/// </summary>
+		/// <remarks>
+		/// 現在の読み込み位置に関係なく、先頭のポインタを返します。
+		/// nullptr 以外を返す Reader からは、Image, Wave, CSVReader, JSONReader, FileArchive がデータをコピーせずに直接解析します。
+		/// </remarks>
+		/// <returns>
+		/// 内容の先頭ポインタ。メモリ上に存在しない場合は nullptr
+		/// </returns>
+		virtual const uint8* data() const
+		{
+			return nullptr;
+		}
+
 		/// <summary>
 		/// Reader からデータを読み込みます。
 		/// </summary>
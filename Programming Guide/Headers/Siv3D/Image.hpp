@@ -151,6 +151,35 @@ namespace s3d
 		};
 	};
 
+	/// <summary>
+	/// PNG の圧縮レベル
+	/// </summary>
+	struct PNGCompression
+	{
+		enum Level
+		{
+			/// <summary>
+			/// 圧縮しない
+			/// </summary>
+			Store = 0,
+
+			/// <summary>
+			/// 高速・低圧縮
+			/// </summary>
+			Fast = 1,
+
+			/// <summary>
+			/// 標準
+			/// </summary>
+			Default = 6,
+
+			/// <summary>
+			/// 低速・高圧縮
+			/// </summary>
+			Best = 9,
+		};
+	};
+
 	/// <summary>
 	/// WebP の圧縮方法
 	/// </summary>
@@ -289,6 +318,27 @@ namespace s3d
 		NormalizedConvolution,
 	};
 
+	/// <summary>
+	/// ミップマップ生成の縮小フィルタ
+	/// </summary>
+	enum class MipFilter
+	{
+		/// <summary>
+		/// 2x2 ピクセルの平均（高速）
+		/// </summary>
+		Box,
+
+		/// <summary>
+		/// Lanczos 法（シャープ）
+		/// </summary>
+		Lanczos,
+
+		/// <summary>
+		/// Kaiser 窓（エイリアシングが少ない）
+		/// </summary>
+		Kaiser,
+	};
+
 	/// <summary>
 	/// 画像
 	/// </summary>
@@ -1096,6 +1146,31 @@ namespace s3d
 		/// </returns>
 		bool savePNG(const FilePath& path, PNGFilter::Flag filterFlag = PNGFilter::Default) const;
 
+		/// <summary>
+		/// 画像を PNG 形式で保存します。
+		/// </summary>
+		/// <param name="path">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="filterFlag">
+		/// 使用する PNG フィルタ
+		/// </param>
+		/// <param name="compressionLevel">
+		/// 圧縮レベル [0, 9]
+		/// </param>
+		/// <param name="parallel">
+		/// 並列にエンコードする場合 true
+		/// </param>
+		/// <remarks>
+		/// parallel が true の場合、行のフィルタ処理と、画像を分割した独立したチャンクの deflate 圧縮を並列に行い、1 つの zlib ストリームに連結します。
+		/// 出力は標準の PNG ファイルです。
+		/// PNGFilter::Sub と PNGCompression::Fast の組み合わせが最も高速です。
+		/// </remarks>
+		/// <returns>
+		/// 保存に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool savePNG(const FilePath& path, PNGFilter::Flag filterFlag, _Field_range_(0, 9) int32 compressionLevel, bool parallel = true) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -1188,6 +1263,28 @@ namespace s3d
 		/// </returns>
 		ByteArray encodePNG(PNGFilter::Flag filterFlag = PNGFilter::Default) const;
 
+		/// <summary>
+		/// 画像を PNG 形式でエンコードします。
+		/// </summary>
+		/// <param name="filterFlag">
+		/// 使用する PNG フィルタ
+		/// </param>
+		/// <param name="compressionLevel">
+		/// 圧縮レベル [0, 9]
+		/// </param>
+		/// <param name="parallel">
+		/// 並列にエンコードする場合 true
+		/// </param>
+		/// <remarks>
+		/// parallel が true の場合、行のフィルタ処理と、画像を分割した独立したチャンクの deflate 圧縮を並列に行い、1 つの zlib ストリームに連結します。
+		/// 出力は標準の PNG ファイルです。
+		/// PNGFilter::Sub と PNGCompression::Fast の組み合わせが最も高速です。
+		/// </remarks>
+		/// <returns>
+		/// エンコードされたデータ
+		/// </returns>
+		ByteArray encodePNG(PNGFilter::Flag filterFlag, _Field_range_(0, 9) int32 compressionLevel, bool parallel = true) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -1499,6 +1596,7 @@ namespace s3d
 		/// </param>
 		/// <remarks>
 		/// http://docs.opencv.org/modules/imgproc/doc/miscellaneous_transformations.html 参照
+		/// AdaptiveMethod::Mean で blockSize が大きい場合は SummedAreaTable を使い、blockSize によらない計算量で処理します。
 		/// </remarks>
 		/// <returns>
 		/// 
@@ -1522,6 +1620,7 @@ namespace s3d
 		/// </param>
 		/// <remarks>
 		/// http://docs.opencv.org/modules/imgproc/doc/miscellaneous_transformations.html 参照
+		/// AdaptiveMethod::Mean で blockSize が大きい場合は SummedAreaTable を使い、blockSize によらない計算量で処理します。
 		/// </remarks>
 		/// <returns>
 		/// 
@@ -1593,6 +1692,9 @@ namespace s3d
 		/// <param name="vertical">
 		/// 
 		/// </param>
+		/// <remarks>
+		/// ぼかしの範囲が大きい場合は SummedAreaTable を使い、範囲の大きさによらない計算量で処理します。
+		/// </remarks>
 		/// <returns>
 		/// 
 		/// </returns>
@@ -1607,6 +1709,9 @@ namespace s3d
 		/// <param name="vertical">
 		/// 
 		/// </param>
+		/// <remarks>
+		/// ぼかしの範囲が大きい場合は SummedAreaTable を使い、範囲の大きさによらない計算量で処理します。
+		/// </remarks>
 		/// <returns>
 		/// 
 		/// </returns>
@@ -2047,6 +2152,52 @@ namespace s3d
 	/// </summary>
 	namespace Imaging
 	{
+		/// <summary>
+		/// 画像処理に使用するスレッド数を設定します。
+		/// </summary>
+		/// <param name="numThreads">
+		/// 使用するスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// 2 以上の場合、Blur, GaussianBlur, MedianBlur, Dilate, Erode, Sobel, Laplacian, Canny, AdaptiveThreshold は
+		/// 画像をフィルタの半径分の重なりを持つ行単位の帯に分割し、ワークスティーリングで並列に処理します。
+		/// デフォルトでは 1 （呼び出し元のスレッドのみで処理）が設定されています。
+		/// </remarks>
+		/// <returns>
+		/// 変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool SetThreadCount(uint32 numThreads);
+
+		/// <summary>
+		/// 画像処理に使用するスレッド数を返します。
+		/// </summary>
+		/// <returns>
+		/// 画像処理に使用するスレッド数
+		/// </returns>
+		uint32 GetThreadCount();
+
+		/// <summary>
+		/// 並列処理で画像を分割する帯の高さを設定します。
+		/// </summary>
+		/// <param name="rows">
+		/// 帯の高さ（ピクセル）。0 の場合は画像サイズとスレッド数から自動で決定
+		/// </param>
+		/// <remarks>
+		/// 帯の数がスレッド数より多いほど負荷が均等になりますが、重なり部分の計算が増えます。
+		/// </remarks>
+		/// <returns>
+		/// 変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool SetBandHeight(uint32 rows);
+
+		/// <summary>
+		/// 並列処理で画像を分割する帯の高さを返します。
+		/// </summary>
+		/// <returns>
+		/// 帯の高さ（ピクセル）。自動で決定する場合は 0
+		/// </returns>
+		uint32 GetBandHeight();
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -2356,6 +2507,7 @@ namespace s3d
 		/// </param>
 		/// <remarks>
 		/// http://docs.opencv.org/modules/imgproc/doc/miscellaneous_transformations.html
+		/// AdaptiveMethod::Mean で blockSize が大きい場合は SummedAreaTable を使い、blockSize によらない計算量で処理します。
 		/// </remarks>
 		/// <returns>
 		/// なし
@@ -2417,6 +2569,9 @@ namespace s3d
 		/// <param name="vertical">
 		/// 
 		/// </param>
+		/// <remarks>
+		/// ぼかしの範囲が大きい場合は SummedAreaTable を使い、範囲の大きさによらない計算量で処理します。
+		/// </remarks>
 		/// <returns>
 		/// なし
 		/// </returns>
@@ -2659,6 +2814,53 @@ namespace s3d
 		/// </returns>
 		Image GenerateMip(const Image& src);
 
+		/// <summary>
+		/// 画像から 1x1 までのすべてのミップマップを生成します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="filter">
+		/// 縮小フィルタ
+		/// </param>
+		/// <param name="sRGB">
+		/// 色を sRGB とみなし、リニア空間で平均する場合 true
+		/// </param>
+		/// <param name="maxLevels">
+		/// 生成する最大のレベル数（入力画像を含む）。0 の場合は 1x1 まで
+		/// </param>
+		/// <remarks>
+		/// 各レベルは 1 つ前のレベルから生成されます。各レベルは行単位の帯に分割され、Imaging::SetThreadCount() で設定したスレッド数で並列に処理されます。
+		/// 結果の先頭は入力画像のコピーで、そのまま Texture(const Array&lt;Image&gt;&amp;, TextureDesc) に渡すことができます。
+		/// </remarks>
+		/// <returns>
+		/// ミップマップの画像の配列
+		/// </returns>
+		Array<Image> GenerateMips(const Image& src, MipFilter filter = MipFilter::Box, bool sRGB = true, uint32 maxLevels = 0);
+
+		/// <summary>
+		/// 画像から 1x1 までのすべてのミップマップを生成します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="filter">
+		/// 縮小フィルタ
+		/// </param>
+		/// <param name="sRGB">
+		/// 色を sRGB とみなし、リニア空間で平均する場合 true
+		/// </param>
+		/// <param name="maxLevels">
+		/// 生成する最大のレベル数（入力画像を含む）。0 の場合は 1x1 まで
+		/// </param>
+		/// <remarks>
+		/// 入力画像はコピーされずに結果の先頭に移動されます。
+		/// </remarks>
+		/// <returns>
+		/// ミップマップの画像の配列
+		/// </returns>
+		Array<Image> GenerateMips(Image&& src, MipFilter filter = MipFilter::Box, bool sRGB = true, uint32 maxLevels = 0);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -0,0 +1,255 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <functional>
+# include "Fwd.hpp"
+# include "PropertyMacro.hpp"
+# include "PointVector.hpp"
+# include "IReader.hpp"
+# include "Image.hpp"
+# include "ImageView.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// ストリーミング画像デコーダ
+	/// </summary>
+	/// <remarks>
+	/// PNG と JPEG を、ファイルを読み込みながら上から順に行単位でデコードします。
+	/// 画像全体をメモリ上に展開しないため、巨大な画像も一定のメモリで処理できます。
+	/// プログレッシブ JPEG とインタレース PNG は、すべてのパスを読み込むまで行を返せないため、内部で画像全体を保持します。
+	/// </remarks>
+	class ImageDecoder
+	{
+	private:
+
+		class CImageDecoder;
+
+		std::shared_ptr<CImageDecoder> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ImageDecoder();
+
+		/// <summary>
+		/// 画像ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// 画像ファイルのパス
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		explicit ImageDecoder(const FilePath& path, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// Reader から画像を開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// Reader
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		explicit ImageDecoder(Reader&& reader, ImageFormat format = ImageFormat::Unspecified)
+			: ImageDecoder()
+		{
+			open(std::move(reader), format);
+		}
+
+		/// <summary>
+		/// Reader から画像を開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// Reader
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		explicit ImageDecoder(const std::shared_ptr<IReader>& reader, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		~ImageDecoder();
+
+		/// <summary>
+		/// 画像ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// 画像ファイルのパス
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path, ImageFormat format = ImageFormat::Unspecified);
+
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		bool open(Reader&& reader, ImageFormat format = ImageFormat::Unspecified)
+		{
+			return open(std::make_shared<Reader>(std::move(reader)), format);
+		}
+
+		bool open(const std::shared_ptr<IReader>& reader, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// 画像を閉じます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// 画像がオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像がオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// 画像がオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像がオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// 画像のフォーマットを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像のフォーマット
+		/// </returns>
+		ImageFormat format() const;
+
+		/// <summary>
+		/// ファイルに記録されている画像の幅と高さ（ピクセル）
+		/// </summary>
+		Property_Get(Size, originalSize) const;
+
+		/// <summary>
+		/// デコード結果の画像の幅と高さ（ピクセル）
+		/// </summary>
+		Property_Get(Size, size) const;
+
+		/// <summary>
+		/// デコード結果の画像の幅（ピクセル）
+		/// </summary>
+		Property_Get(int32, width) const { return size.x; }
+
+		/// <summary>
+		/// デコード結果の画像の高さ（ピクセル）
+		/// </summary>
+		Property_Get(int32, height) const { return size.y; }
+
+		/// <summary>
+		/// デコード結果の画像のサイズを指定します。
+		/// </summary>
+		/// <param name="size">
+		/// デコード結果の画像の幅と高さ（ピクセル）
+		/// </param>
+		/// <param name="interpolation">
+		/// 拡大縮小の手法
+		/// </param>
+		/// <remarks>
+		/// 最初の行をデコードする前に呼ぶ必要があります。
+		/// JPEG で縮小する場合は DCT スケーリング（1/2, 1/4, 1/8）で指定したサイズ以上の最小のサイズにデコードしてから縮小するため、
+		/// 元のサイズの画像は作成されません。
+		/// </remarks>
+		/// <returns>
+		/// 変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool setOutputSize(const Size& size, Interpolation interpolation = Interpolation::Area);
+
+		/// <summary>
+		/// 次にデコードされる行の位置を返します。
+		/// </summary>
+		/// <returns>
+		/// 次にデコードされる行の位置
+		/// </returns>
+		int32 currentRow() const;
+
+		/// <summary>
+		/// すべての行をデコードしたかを返します。
+		/// </summary>
+		/// <returns>
+		/// すべての行をデコードした場合 true, それ以外の場合は false
+		/// </returns>
+		bool isFinished() const;
+
+		/// <summary>
+		/// 次の行から指定した行数をデコードします。
+		/// </summary>
+		/// <param name="dst">
+		/// 書き込み先。幅はデコード結果の画像の幅と同じである必要があります
+		/// </param>
+		/// <remarks>
+		/// dst の高さまでの行をデコードします。
+		/// </remarks>
+		/// <returns>
+		/// 実際にデコードした行数。エラーの場合は -1
+		/// </returns>
+		int32 readRows(const MutableImageView& dst);
+
+		/// <summary>
+		/// 残りのすべての行を、指定した行数ごとにデコードしてコールバックに渡します。
+		/// </summary>
+		/// <param name="callback">
+		/// デコードした行と、その先頭の行の位置を受け取る関数
+		/// </param>
+		/// <param name="bandHeight">
+		/// 一度に渡す最大の行数
+		/// </param>
+		/// <returns>
+		/// すべての行のデコードに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool decode(std::function<void(const ImageView& rows, int32 y)> callback, int32 bandHeight = 64);
+
+		/// <summary>
+		/// 残りのすべての行をデコードして画像を返します。
+		/// </summary>
+		/// <returns>
+		/// デコードした画像。エラーの場合は空の画像
+		/// </returns>
+		Image decodeAll();
+	};
+
+	namespace Imaging
+	{
+		/// <summary>
+		/// 画像ファイルを、元のサイズの画像を作成せずに縮小してロードします。
+		/// </summary>
+		/// <param name="path">
+		/// 画像ファイルのパス
+		/// </param>
+		/// <param name="maxSize">
+		/// 縮小後の最大の幅と高さ（ピクセル）
+		/// </param>
+		/// <remarks>
+		/// アスペクト比を保ったまま maxSize に収まるように縮小します。
+		/// PNG と JPEG 以外のフォーマットは、画像全体をロードしてから縮小します。
+		/// </remarks>
+		/// <returns>
+		/// 縮小した画像
+		/// </returns>
+		Image LoadThumbnail(const FilePath& path, const Size& maxSize);
+	}
+}
@@ -0,0 +1,402 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <functional>
+# include "Fwd.hpp"
+# include "Array.hpp"
+# include "Image.hpp"
+# include "ImageView.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// 遅延評価される画像処理のパイプライン
+	/// </summary>
+	/// <remarks>
+	/// 画像処理を記録しておき、execute() でまとめて実行します。
+	/// 連続するピクセル単位の処理は 1 回の走査に融合され、近傍処理はフィルタの半径分の行バッファを使ってストリーム処理されるため、
+	/// 途中結果の画像は作成されません。
+	/// 入力画像は execute() を呼ぶまで有効である必要があります。
+	/// </remarks>
+	class ImagePipeline
+	{
+	private:
+
+		enum class StageType
+		{
+			ForEach,
+
+			Negate,
+
+			Grayscale,
+
+			Sepia,
+
+			Postarize,
+
+			Brighten,
+
+			GammaCorrect,
+
+			Threshold,
+
+			SwapARGBtoABGR,
+
+			Blur,
+
+			MedianBlur,
+
+			GaussianBlur,
+
+			Dilate,
+
+			Erode,
+		};
+
+		struct Stage
+		{
+			StageType type;
+
+			int32 param0;
+
+			int32 param1;
+
+			double paramF;
+
+			std::function<void(Color&)> function;
+		};
+
+		ImageView m_src;
+
+		Array<Stage> m_stages;
+
+		static bool IsPointwise(StageType type)
+		{
+			return type <= StageType::SwapARGBtoABGR;
+		}
+
+		ImagePipeline& addStage(StageType type, int32 param0 = 0, int32 param1 = 0, double paramF = 0.0, std::function<void(Color&)> function = nullptr)
+		{
+			m_stages.push_back({ type, param0, param1, paramF, function });
+
+			return *this;
+		}
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ImagePipeline() = default;
+
+		/// <summary>
+		/// 入力画像を指定してパイプラインを作成します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		explicit ImagePipeline(const ImageView& src)
+			: m_src(src) {}
+
+		/// <summary>
+		/// 一時的な Image からはパイプラインを作成できません。
+		/// </summary>
+		/// <remarks>
+		/// パイプラインは入力画像を参照するだけなので、execute() の前に Image が破棄されてしまいます。
+		/// </remarks>
+		explicit ImagePipeline(Image&&) = delete;
+
+		/// <summary>
+		/// 入力画像を返します。
+		/// </summary>
+		/// <returns>
+		/// 入力画像
+		/// </returns>
+		const ImageView& source() const
+		{
+			return m_src;
+		}
+
+		/// <summary>
+		/// 記録されている処理の数を返します。
+		/// </summary>
+		/// <returns>
+		/// 記録されている処理の数
+		/// </returns>
+		size_t numStages() const
+		{
+			return m_stages.size();
+		}
+
+		/// <summary>
+		/// 実行時の画像の走査回数を返します。
+		/// </summary>
+		/// <remarks>
+		/// 連続するピクセル単位の処理は 1 回の走査にまとめて数えます。
+		/// </remarks>
+		/// <returns>
+		/// 画像の走査回数
+		/// </returns>
+		size_t numPasses() const
+		{
+			size_t passes = 0;
+
+			bool previousPointwise = false;
+
+			for (const auto& stage : m_stages)
+			{
+				const bool pointwise = IsPointwise(stage.type);
+
+				if (!(pointwise && previousPointwise))
+				{
+					++passes;
+				}
+
+				previousPointwise = pointwise;
+			}
+
+			return passes;
+		}
+
+		/// <summary>
+		/// 記録されている処理をすべて消去します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void clear()
+		{
+			m_stages.clear();
+		}
+
+		/// <summary>
+		/// すべてのピクセルに変換関数を適用する処理を追加します。
+		/// </summary>
+		/// <param name="function">
+		/// 変換関数
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& forEach(std::function<void(Color&)> function)
+		{
+			return addStage(StageType::ForEach, 0, 0, 0.0, function);
+		}
+
+		/// <summary>
+		/// ネガポジ反転処理を追加します。
+		/// </summary>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& negate()
+		{
+			return addStage(StageType::Negate);
+		}
+
+		/// <summary>
+		/// グレースケール変換を追加します。
+		/// </summary>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& grayscale()
+		{
+			return addStage(StageType::Grayscale);
+		}
+
+		/// <summary>
+		/// セピア調変換を追加します。
+		/// </summary>
+		/// <param name="level">
+		/// セピアの強さ [0,255]
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& sepia(int32 level = 25)
+		{
+			return addStage(StageType::Sepia, level);
+		}
+
+		/// <summary>
+		/// ポスタライズ処理を追加します。
+		/// </summary>
+		/// <param name="level">
+		/// 各チャンネルの段階数
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& postarize(int32 level)
+		{
+			return addStage(StageType::Postarize, level);
+		}
+
+		/// <summary>
+		/// 明るさの変更を追加します。
+		/// </summary>
+		/// <param name="level">
+		/// 明るさの変更量
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& brighten(int32 level)
+		{
+			return addStage(StageType::Brighten, level);
+		}
+
+		/// <summary>
+		/// ガンマ補正を追加します。
+		/// </summary>
+		/// <param name="gamma">
+		/// ガンマ値
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& gammaCorrect(double gamma)
+		{
+			return addStage(StageType::GammaCorrect, 0, 0, gamma);
+		}
+
+		/// <summary>
+		/// 閾値処理を追加します。
+		/// </summary>
+		/// <param name="threshold">
+		/// 閾値
+		/// </param>
+		/// <param name="inverse">
+		/// 結果の白黒の反転
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& threshold(uint8 threshold, bool inverse = false)
+		{
+			return addStage(StageType::Threshold, threshold, inverse);
+		}
+
+		/// <summary>
+		/// ARGB と ABGR の変換を追加します。
+		/// </summary>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& ARGBtoABGR()
+		{
+			return addStage(StageType::SwapARGBtoABGR);
+		}
+
+		/// <summary>
+		/// ぼかし処理を追加します。
+		/// </summary>
+		/// <param name="horizontal">
+		/// 水平方向のぼかしの大きさ
+		/// </param>
+		/// <param name="vertical">
+		/// 垂直方向のぼかしの大きさ
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& blur(int32 horizontal, int32 vertical)
+		{
+			return addStage(StageType::Blur, horizontal, vertical);
+		}
+
+		/// <summary>
+		/// メディアンフィルタ処理を追加します。
+		/// </summary>
+		/// <param name="apertureSize">
+		/// フィルタの大きさ
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& medianBlur(int32 apertureSize)
+		{
+			return addStage(StageType::MedianBlur, apertureSize);
+		}
+
+		/// <summary>
+		/// ガウスぼかし処理を追加します。
+		/// </summary>
+		/// <param name="horizontal">
+		/// 水平方向のぼかしの大きさ
+		/// </param>
+		/// <param name="vertical">
+		/// 垂直方向のぼかしの大きさ
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& gaussianBlur(int32 horizontal, int32 vertical)
+		{
+			return addStage(StageType::GaussianBlur, horizontal, vertical);
+		}
+
+		/// <summary>
+		/// 膨張処理を追加します。
+		/// </summary>
+		/// <param name="iterations">
+		/// 処理の回数
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& dilate(int32 iterations = 1)
+		{
+			return addStage(StageType::Dilate, iterations);
+		}
+
+		/// <summary>
+		/// 収縮処理を追加します。
+		/// </summary>
+		/// <param name="iterations">
+		/// 処理の回数
+		/// </param>
+		/// <returns>
+		/// *this
+		/// </returns>
+		ImagePipeline& erode(int32 iterations = 1)
+		{
+			return addStage(StageType::Erode, iterations);
+		}
+
+		/// <summary>
+		/// 記録されている処理を実行し、結果の画像を返します。
+		/// </summary>
+		/// <remarks>
+		/// 結果の画像のメモリ確保は 1 回だけ行われます。
+		/// </remarks>
+		/// <returns>
+		/// 結果の画像
+		/// </returns>
+		Image execute() const;
+
+		/// <summary>
+		/// 記録されている処理を実行し、結果を出力画像に書き込みます。
+		/// </summary>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// 出力画像は入力画像と同じメモリを参照していても構いません。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool execute(const MutableImageView& dst) const;
+	};
+}
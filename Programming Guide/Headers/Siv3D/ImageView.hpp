@@ -0,0 +1,1066 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Fwd.hpp"
+# include "Color.hpp"
+# include "Rectangle.hpp"
+# include "Image.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// 読み取り専用の画像ビュー
+	/// </summary>
+	/// <remarks>
+	/// メモリ上の既存のピクセルデータを、コピーせずに画像として参照します。
+	/// 各行の間隔（ストライド）は幅と一致している必要はありません。
+	/// 参照先のデータの寿命は呼び出し側で管理する必要があります。
+	/// </remarks>
+	class ImageView
+	{
+	private:
+
+		const uint8* m_data = nullptr;
+
+		int32 m_width = 0;
+
+		int32 m_height = 0;
+
+		size_t m_stride = 0;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ImageView() = default;
+
+		/// <summary>
+		/// ピクセルデータへの画像ビューを作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 先頭行の先頭ピクセルへのポインタ
+		/// </param>
+		/// <param name="width">
+		/// 画像の幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 画像の高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		ImageView(const Color* data, int32 width, int32 height, size_t stride)
+			: m_data(reinterpret_cast<const uint8*>(data))
+			, m_width(data ? width : 0)
+			, m_height(data ? height : 0)
+			, m_stride(stride) {}
+
+		/// <summary>
+		/// ピクセルデータへの画像ビューを作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 先頭行の先頭ピクセルへのポインタ
+		/// </param>
+		/// <param name="size">
+		/// 画像の幅と高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		ImageView(const Color* data, const Size& size, size_t stride)
+			: ImageView(data, size.x, size.y, stride) {}
+
+		/// <summary>
+		/// 画像全体への画像ビューを作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		ImageView(const Image& image)
+			: ImageView(image ? image[0] : nullptr, image.width, image.height, image.stride) {}
+
+		/// <summary>
+		/// 画像ビューが空ではないかを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像ビューが空ではない場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const
+		{
+			return !isEmpty;
+		}
+
+		/// <summary>
+		/// 画像の幅（ピクセル）
+		/// </summary>
+		Property_Get(int32, width) const { return m_width; }
+
+		/// <summary>
+		/// 画像の高さ（ピクセル）
+		/// </summary>
+		Property_Get(int32, height) const { return m_height; }
+
+		/// <summary>
+		/// 画像の幅と高さ（ピクセル）
+		/// </summary>
+		Property_Get(Size, size) const { return{ m_width, m_height }; }
+
+		/// <summary>
+		/// 各行の先頭の間隔（バイト）
+		/// </summary>
+		Property_Get(size_t, stride) const { return m_stride; }
+
+		/// <summary>
+		/// 画像が空であるか
+		/// </summary>
+		Property_Get(bool, isEmpty) const { return m_width <= 0 || m_height <= 0; }
+
+		/// <summary>
+		/// 各行のピクセルが隙間なく連続しているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 連続している場合 true, それ以外の場合は false
+		/// </returns>
+		bool isContiguous() const
+		{
+			return m_stride == m_width * sizeof(Color);
+		}
+
+		/// <summary>
+		/// 指定した行の先頭ポインタを返します。
+		/// </summary>
+		/// <param name="y">
+		/// 位置(行)
+		/// </param>
+		/// <returns>
+		/// 指定した行の先頭ポインタ
+		/// </returns>
+		const Color* operator [](uint32 y) const
+		{
+			return reinterpret_cast<const Color*>(m_data + m_stride * y);
+		}
+
+		const Color& operator [](const Point& pos) const
+		{
+			return operator[](pos.y)[pos.x];
+		}
+
+		/// <summary>
+		/// 画像データの先頭のポインタを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像データの先頭へのポインタ
+		/// </returns>
+		const void* data() const
+		{
+			return m_data;
+		}
+
+		/// <summary>
+		/// 画像の一部分への画像ビューを返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 画像上の範囲
+		/// </param>
+		/// <remarks>
+		/// 範囲は画像の内側に切り詰められます。
+		/// </remarks>
+		/// <returns>
+		/// 一部分への画像ビュー
+		/// </returns>
+		ImageView subView(const Rect& rect) const
+		{
+			const int32 x0 = Clamp(rect.x, 0, m_width);
+			const int32 y0 = Clamp(rect.y, 0, m_height);
+			const int32 x1 = Clamp(rect.x + rect.w, x0, m_width);
+			const int32 y1 = Clamp(rect.y + rect.h, y0, m_height);
+
+			if (x0 == x1 || y0 == y1)
+			{
+				return ImageView();
+			}
+
+			return ImageView(operator[](y0) + x0, x1 - x0, y1 - y0, m_stride);
+		}
+
+		/// <summary>
+		/// 参照しているピクセルをコピーした新しい画像を返します。
+		/// </summary>
+		/// <returns>
+		/// 新しい画像
+		/// </returns>
+		Image toImage() const
+		{
+			if (isEmpty)
+			{
+				return Image();
+			}
+
+			Image image(static_cast<uint32>(m_width), static_cast<uint32>(m_height));
+
+			for (int32 y = 0; y < m_height; ++y)
+			{
+				std::copy(operator[](y), operator[](y) + m_width, image[y]);
+			}
+
+			return image;
+		}
+	};
+
+	/// <summary>
+	/// 書き込み可能な画像ビュー
+	/// </summary>
+	/// <remarks>
+	/// メモリ上の既存のピクセルデータを、コピーせずに画像として参照し、書き換えます。
+	/// 各行の間隔（ストライド）は幅と一致している必要はありません。
+	/// 参照先のデータの寿命は呼び出し側で管理する必要があります。
+	/// </remarks>
+	class MutableImageView
+	{
+	private:
+
+		uint8* m_data = nullptr;
+
+		int32 m_width = 0;
+
+		int32 m_height = 0;
+
+		size_t m_stride = 0;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		MutableImageView() = default;
+
+		/// <summary>
+		/// ピクセルデータへの画像ビューを作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 先頭行の先頭ピクセルへのポインタ
+		/// </param>
+		/// <param name="width">
+		/// 画像の幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 画像の高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		MutableImageView(Color* data, int32 width, int32 height, size_t stride)
+			: m_data(reinterpret_cast<uint8*>(data))
+			, m_width(data ? width : 0)
+			, m_height(data ? height : 0)
+			, m_stride(stride) {}
+
+		/// <summary>
+		/// ピクセルデータへの画像ビューを作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 先頭行の先頭ピクセルへのポインタ
+		/// </param>
+		/// <param name="size">
+		/// 画像の幅と高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		MutableImageView(Color* data, const Size& size, size_t stride)
+			: MutableImageView(data, size.x, size.y, stride) {}
+
+		/// <summary>
+		/// 画像全体への画像ビューを作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		MutableImageView(Image& image)
+			: MutableImageView(image ? image[0] : nullptr, image.width, image.height, image.stride) {}
+
+		/// <summary>
+		/// 読み取り専用の画像ビューに変換します。
+		/// </summary>
+		operator ImageView() const
+		{
+			return ImageView(reinterpret_cast<const Color*>(m_data), m_width, m_height, m_stride);
+		}
+
+		/// <summary>
+		/// 画像ビューが空ではないかを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像ビューが空ではない場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const
+		{
+			return !isEmpty;
+		}
+
+		/// <summary>
+		/// 画像の幅（ピクセル）
+		/// </summary>
+		Property_Get(int32, width) const { return m_width; }
+
+		/// <summary>
+		/// 画像の高さ（ピクセル）
+		/// </summary>
+		Property_Get(int32, height) const { return m_height; }
+
+		/// <summary>
+		/// 画像の幅と高さ（ピクセル）
+		/// </summary>
+		Property_Get(Size, size) const { return{ m_width, m_height }; }
+
+		/// <summary>
+		/// 各行の先頭の間隔（バイト）
+		/// </summary>
+		Property_Get(size_t, stride) const { return m_stride; }
+
+		/// <summary>
+		/// 画像が空であるか
+		/// </summary>
+		Property_Get(bool, isEmpty) const { return m_width <= 0 || m_height <= 0; }
+
+		/// <summary>
+		/// 各行のピクセルが隙間なく連続しているかを返します。
+		/// </summary>
+		/// <returns>
+		/// 連続している場合 true, それ以外の場合は false
+		/// </returns>
+		bool isContiguous() const
+		{
+			return m_stride == m_width * sizeof(Color);
+		}
+
+		/// <summary>
+		/// 指定した行の先頭ポインタを返します。
+		/// </summary>
+		/// <param name="y">
+		/// 位置(行)
+		/// </param>
+		/// <returns>
+		/// 指定した行の先頭ポインタ
+		/// </returns>
+		Color* operator [](uint32 y) const
+		{
+			return reinterpret_cast<Color*>(m_data + m_stride * y);
+		}
+
+		Color& operator [](const Point& pos) const
+		{
+			return operator[](pos.y)[pos.x];
+		}
+
+		/// <summary>
+		/// 画像データの先頭のポインタを返します。
+		/// </summary>
+		/// <returns>
+		/// 画像データの先頭へのポインタ
+		/// </returns>
+		void* data() const
+		{
+			return m_data;
+		}
+
+		/// <summary>
+		/// 画像の一部分への画像ビューを返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 画像上の範囲
+		/// </param>
+		/// <remarks>
+		/// 範囲は画像の内側に切り詰められます。
+		/// </remarks>
+		/// <returns>
+		/// 一部分への画像ビュー
+		/// </returns>
+		MutableImageView subView(const Rect& rect) const
+		{
+			const int32 x0 = Clamp(rect.x, 0, m_width);
+			const int32 y0 = Clamp(rect.y, 0, m_height);
+			const int32 x1 = Clamp(rect.x + rect.w, x0, m_width);
+			const int32 y1 = Clamp(rect.y + rect.h, y0, m_height);
+
+			if (x0 == x1 || y0 == y1)
+			{
+				return MutableImageView();
+			}
+
+			return MutableImageView(operator[](y0) + x0, x1 - x0, y1 - y0, m_stride);
+		}
+
+		/// <summary>
+		/// 画像を指定した色で塗りつぶします。
+		/// </summary>
+		/// <param name="color">
+		/// 塗りつぶしの色
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void fill(const Color& color) const
+		{
+			for (int32 y = 0; y < m_height; ++y)
+			{
+				Color* pDst = operator[](y);
+				const Color* const pDstEnd = pDst + m_width;
+
+				while (pDst != pDstEnd)
+				{
+					(*pDst++) = color;
+				}
+			}
+		}
+
+		/// <summary>
+		/// 画像ビューの内容を上書きします。
+		/// </summary>
+		/// <param name="src">
+		/// コピー元の画像ビュー
+		/// </param>
+		/// <remarks>
+		/// 画像ビューのサイズが異なる場合は何もしません。
+		/// コピー元とコピー先の範囲が重なっていてはいけません。
+		/// </remarks>
+		/// <returns>
+		/// コピーに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool copyFrom(const ImageView& src) const
+		{
+			if (src.size != size)
+			{
+				return false;
+			}
+
+			for (int32 y = 0; y < m_height; ++y)
+			{
+				std::copy(src[y], src[y] + m_width, operator[](y));
+			}
+
+			return true;
+		}
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <remarks>
+	/// ImageView / MutableImageView を入力画像・出力画像とするオーバーロードです。
+	/// 出力先は画像ビューのサイズを変更できないため、出力画像のサイズが期待するサイズと異なる場合は何もせずに false を返します。
+	/// </remarks>
+	namespace Imaging
+	{
+		/// <summary>
+		/// すべてのピクセルに変換関数を適用します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="function">
+		/// 変換関数
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool ForEach(const ImageView& src, const MutableImageView& dst, std::function<void(Color&)> function);
+
+		/// <summary>
+		/// ネガポジ反転処理を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Negate(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// グレースケール変換を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Grayscale(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// セピア調変換を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="level">
+		/// セピアの強さ [0,255]
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Sepia(const ImageView& src, const MutableImageView& dst, int32 level = 25);
+
+		/// <summary>
+		/// ポスタライズ処理を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="level">
+		/// 各チャンネルの段階数
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Postarize(const ImageView& src, const MutableImageView& dst, int32 level);
+
+		/// <summary>
+		/// 明るさを変更します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="level">
+		/// 変更レベル
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Brighten(const ImageView& src, const MutableImageView& dst, int32 level);
+
+		/// <summary>
+		/// 上下反転します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Flip(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// 左右反転します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Mirror(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// 時計回りに 90° 回転します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像の幅と高さは入力画像の高さと幅と一致している必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Rotate90(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// 時計回りに 180° 回転します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Rotate180(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// 時計回りに 270° 回転します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像の幅と高さは入力画像の高さと幅と一致している必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Rotate270(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// ガンマ補正を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="gamma">
+		/// ガンマ値
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool GammaCorrect(const ImageView& src, const MutableImageView& dst, double gamma);
+
+		/// <summary>
+		/// 閾値処理を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="threshold">
+		/// 閾値
+		/// </param>
+		/// <param name="inverse">
+		/// 結果の白黒の反転
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Threshold(const ImageView& src, const MutableImageView& dst, uint8 threshold, bool inverse = false);
+
+		/// <summary>
+		/// 適応的な閾値処理を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="method">
+		/// 適応的閾値アルゴリズム
+		/// </param>
+		/// <param name="blockSize">
+		/// 閾値を求めるために利用される近傍領域のサイズ。奇数
+		/// </param>
+		/// <param name="c">
+		/// 平均または加重平均から引かれる定数
+		/// </param>
+		/// <param name="inverse">
+		/// 結果の白黒の反転
+		/// </param>
+		/// <remarks>
+		/// http://docs.opencv.org/modules/imgproc/doc/miscellaneous_transformations.html
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool AdaptiveThreshold(const ImageView& src, const MutableImageView& dst, AdaptiveMethod method, int32 blockSize, int32 c, bool inverse = false);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="horizontal">
+		/// 
+		/// </param>
+		/// <param name="vertical">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Mosaic(const ImageView& src, const MutableImageView& dst, int32 horizontal, int32 vertical);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="horizontal">
+		/// 
+		/// </param>
+		/// <param name="vertical">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Spread(const ImageView& src, const MutableImageView& dst, int32 horizontal, int32 vertical);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="horizontal">
+		/// 
+		/// </param>
+		/// <param name="vertical">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Blur(const ImageView& src, const MutableImageView& dst, int32 horizontal, int32 vertical);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="apertureSize">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool MedianBlur(const ImageView& src, const MutableImageView& dst, int32 apertureSize);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="horizontal">
+		/// 
+		/// </param>
+		/// <param name="vertical">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool GaussianBlur(const ImageView& src, const MutableImageView& dst, int32 horizontal, int32 vertical);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="iterations">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Dilate(const ImageView& src, const MutableImageView& dst, int32 iterations = 1);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="iterations">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Erode(const ImageView& src, const MutableImageView& dst, int32 iterations = 1);
+
+		/// <summary>
+		/// 画像に塗りつぶし処理を行います。
+		/// </summary>
+		/// <param name="src">
+		/// 塗りつぶし対象の画像
+		/// </param>
+		/// <param name="dst">
+		/// 塗りつぶした結果の画像のコピー先
+		/// </param>
+		/// <param name="pos">
+		/// 塗りつぶし開始位置
+		/// </param>
+		/// <param name="color">
+		/// 塗りつぶしの色
+		/// </param>
+		/// <param name="connectivity">
+		/// 塗りつぶされるかどうかの接続性チェックの方式
+		/// </param>
+		/// <param name="lowerDifference">
+		/// 塗りつぶされる色の許容範囲
+		/// </param>
+		/// <param name="upperDifference">
+		/// 塗りつぶされる色の許容範囲
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool FloodFill(const ImageView& src, const MutableImageView& dst, const Point& pos, const Color& color, FloodFillConnectivity connectivity = FloodFillConnectivity::Value4, int32 lowerDifference = 0, int32 upperDifference = 0);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <remarks>
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool SwapARGBtoABGR(const ImageView& src, const MutableImageView& dst);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="dx">
+		/// 
+		/// </param>
+		/// <param name="dy">
+		/// 
+		/// </param>
+		/// <param name="apertureSize">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 入力と出力を同じ Image にすることはできません。
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Sobel(const ImageView& src, const MutableImageView& dst, int32 dx = 1, int32 dy = 1, int32 apertureSize = 3);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="apertureSize">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 入力と出力を同じ Image にすることはできません。
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Laplacian(const ImageView& src, const MutableImageView& dst, int32 apertureSize = 3);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="lowThreshold">
+		/// 
+		/// </param>
+		/// <param name="highThreshold">
+		/// 
+		/// </param>
+		/// <param name="apertureSize">
+		/// 
+		/// </param>
+		/// <param name="useL2Gradient">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 入力と出力を同じ Image にすることはできません。
+		/// 出力画像は入力画像と同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 処理に成功した場合 true, 出力画像のサイズが異なる場合は false
+		/// </returns>
+		bool Canny(const ImageView& src, const MutableImageView& dst, uint8 lowThreshold, uint8 highThreshold, int32 apertureSize = 3, bool useL2Gradient = false);
+
+		bool EdgePreservingFilter(const ImageView& src, const MutableImageView& dst, EdgePreservingFilterType filterType = EdgePreservingFilterType::Recursive, _Field_range_(0.0, 200.0) double sigma_s = 60, _Field_range_(0.0, 1.0) double sigma_r = 0.4);
+
+		bool DetailEnhance(const ImageView& src, const MutableImageView& dst, _Field_range_(0.0, 200.0) double sigma_s = 10, _Field_range_(0.0, 1.0) double sigma_r = 0.15);
+
+		bool Stylization(const ImageView& src, const MutableImageView& dst, _Field_range_(0.0, 200.0) double sigma_s = 60, _Field_range_(0.0, 1.0) double sigma_r = 0.07);
+
+		/// <summary>
+		/// 出力画像のサイズに合わせて画像を拡大縮小します。
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <param name="dst">
+		/// 出力画像
+		/// </param>
+		/// <param name="interpolation">
+		/// 拡大縮小の手法
+		/// </param>
+		/// <returns>
+		/// 処理に成功した場合 true, 入力画像または出力画像が空の場合は false
+		/// </returns>
+		bool Scale(const ImageView& src, const MutableImageView& dst, Interpolation interpolation = Interpolation::Unspecified);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="src">
+		/// 入力画像
+		/// </param>
+		/// <returns>
+		/// 
+		/// </returns>
+		Image GenerateMip(const ImageView& src);
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="image1">
+		/// 
+		/// </param>
+		/// <param name="image2">
+		/// 
+		/// </param>
+		/// <remarks>
+		/// 比較する画像は同じサイズである必要があります。
+		/// </remarks>
+		/// <returns>
+		/// RGB 各チャンネルの SSIM
+		/// </returns>
+		ColorF SSIM(const ImageView& image1, const ImageView& image2);
+	}
+}
@@ -0,0 +1,408 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <cstring>
+# include "Fwd.hpp"
+# include "Optional.hpp"
+# include "String.hpp"
+# include "IReader.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// JSON のトークンの種類
+	/// </summary>
+	enum class JSONTokenType
+	{
+		/// <summary>
+		/// オブジェクトの開始 {
+		/// </summary>
+		BeginObject,
+
+		/// <summary>
+		/// オブジェクトの終了 }
+		/// </summary>
+		EndObject,
+
+		/// <summary>
+		/// 配列の開始 [
+		/// </summary>
+		BeginArray,
+
+		/// <summary>
+		/// 配列の終了 ]
+		/// </summary>
+		EndArray,
+
+		/// <summary>
+		/// オブジェクトのキー
+		/// </summary>
+		Key,
+
+		/// <summary>
+		/// 文字列
+		/// </summary>
+		String,
+
+		/// <summary>
+		/// 数値
+		/// </summary>
+		Number,
+
+		/// <summary>
+		/// true または false
+		/// </summary>
+		Bool,
+
+		/// <summary>
+		/// null
+		/// </summary>
+		Null,
+
+		/// <summary>
+		/// データの終端
+		/// </summary>
+		End,
+
+		/// <summary>
+		/// 構文エラー
+		/// </summary>
+		Error,
+	};
+
+	/// <summary>
+	/// JSON のトークン
+	/// </summary>
+	/// <remarks>
+	/// data は元の UTF-8 のデータの一部を指し、文字列のコピーは作成されません。
+	/// 文字列とキーでは引用符を含まず、エスケープシーケンスはそのまま残ります。
+	/// </remarks>
+	struct JSONToken
+	{
+		/// <summary>
+		/// トークンの種類
+		/// </summary>
+		JSONTokenType type = JSONTokenType::End;
+
+		/// <summary>
+		/// トークンの UTF-8 の文字列の先頭ポインタ
+		/// </summary>
+		const char* data = nullptr;
+
+		/// <summary>
+		/// トークンの UTF-8 の文字列の長さ（バイト）
+		/// </summary>
+		size_t size = 0;
+
+		/// <summary>
+		/// 文字列にエスケープシーケンスが含まれているか
+		/// </summary>
+		bool hasEscape = false;
+
+		/// <summary>
+		/// トークンの入れ子の深さ。最上位の値は 0
+		/// </summary>
+		uint32 depth = 0;
+
+		/// <summary>
+		/// トークンの文字列が、指定した ASCII 文字列と一致するかを返します。
+		/// </summary>
+		/// <param name="str">
+		/// 比較する null 終端の文字列
+		/// </param>
+		/// <remarks>
+		/// メモリの確保は行いません。エスケープシーケンスを含む文字列は toString() で比較してください。
+		/// </remarks>
+		/// <returns>
+		/// 一致する場合 true, それ以外の場合は false
+		/// </returns>
+		bool equals(const char* str) const
+		{
+			const size_t length = std::strlen(str);
+
+			if (size == 0)
+			{
+				return length == 0;
+			}
+
+			return !hasEscape && length == size && std::memcmp(data, str, size) == 0;
+		}
+
+		/// <summary>
+		/// トークンの文字列を、エスケープシーケンスを解除した String に変換します。
+		/// </summary>
+		/// <returns>
+		/// 変換した文字列
+		/// </returns>
+		String toString() const;
+
+		/// <summary>
+		/// 数値のトークンを整数に変換します。
+		/// </summary>
+		/// <returns>
+		/// 変換した整数。変換に失敗した場合は none
+		/// </returns>
+		Optional<int64> toInt64() const;
+
+		/// <summary>
+		/// 数値のトークンを浮動小数点数に変換します。
+		/// </summary>
+		/// <returns>
+		/// 変換した浮動小数点数。変換に失敗した場合は none
+		/// </returns>
+		Optional<double> toDouble() const;
+
+		/// <summary>
+		/// Bool のトークンの値を返します。
+		/// </summary>
+		/// <returns>
+		/// true のトークンの場合 true, それ以外の場合は false
+		/// </returns>
+		bool toBool() const
+		{
+			return type == JSONTokenType::Bool && size == 4;
+		}
+	};
+
+	/// <summary>
+	/// JSON のストリーミング読み込み
+	/// </summary>
+	/// <remarks>
+	/// JSONValue のツリーを作成せずに、JSON のトークンを先頭から順に 1 つずつ返します。
+	/// ファイルはメモリマップして読み込み、Reader が data() を返す場合はそのメモリを直接読み込むため、トークンの文字列はコピーされません。
+	/// それ以外の Reader からは固定サイズのバッファで少しずつ読み込みます。その場合、next(), peek(), skipValue() はバッファを読み込み直すことがあるため、トークンの data はこれらのいずれかを次に呼ぶまで有効です。
+	/// 入力は UTF-8 である必要があります。
+	/// </remarks>
+	class JSONPullReader
+	{
+	private:
+
+		class CJSONPullReader;
+
+		std::shared_ptr<CJSONPullReader> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		JSONPullReader();
+
+		/// <summary>
+		/// JSON ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		explicit JSONPullReader(const FilePath& path);
+
+		/// <summary>
+		/// JSON データを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// IReader
+		/// </param>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		explicit JSONPullReader(Reader&& reader)
+			: JSONPullReader()
+		{
+			open(std::move(reader));
+		}
+
+		/// <summary>
+		/// JSON データを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// IReader
+		/// </param>
+		explicit JSONPullReader(const std::shared_ptr<IReader>& reader);
+
+		/// <summary>
+		/// メモリ上の JSON データを開きます。
+		/// </summary>
+		/// <param name="data">
+		/// UTF-8 の JSON データの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// データのサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// データはコピーされないため、読み込みが終わるまで有効である必要があります。
+		/// </remarks>
+		JSONPullReader(const char* data, size_t size);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		~JSONPullReader();
+
+		/// <summary>
+		/// JSON ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <returns>
+		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path);
+
+		/// <summary>
+		/// JSON データを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// IReader
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		template <class Reader, class = std::enable_if_t<std::is_base_of<IReader, Reader>::value>>
+		bool open(Reader&& reader)
+		{
+			return open(std::make_shared<Reader>(std::move(reader)));
+		}
+
+		/// <summary>
+		/// JSON データを Reader から開きます。
+		/// </summary>
+		/// <param name="reader">
+		/// IReader
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const std::shared_ptr<IReader>& reader);
+
+		/// <summary>
+		/// メモリ上の JSON データを開きます。
+		/// </summary>
+		/// <param name="data">
+		/// UTF-8 の JSON データの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// データのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const char* data, size_t size);
+
+		/// <summary>
+		/// JSON データを閉じます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// JSON データがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// JSON データがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// JSON データがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// JSON データがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// 次のトークンを読み込みます。
+		/// </summary>
+		/// <remarks>
+		/// メモリの確保は行いません。データの終端では End, 構文エラーでは Error のトークンを返し、それ以降も同じトークンを返します。
+		/// </remarks>
+		/// <returns>
+		/// 読み込んだトークン
+		/// </returns>
+		JSONToken next();
+
+		/// <summary>
+		/// 次のトークンを、読み込み位置を進めずに返します。
+		/// </summary>
+		/// <remarks>
+		/// 固定サイズのバッファで読み込んでいる場合、バッファを読み込み直すことがあるため、それまでに得たトークンの data は無効になります。
+		/// </remarks>
+		/// <returns>
+		/// 次のトークン
+		/// </returns>
+		JSONToken peek();
+
+		/// <summary>
+		/// 次の値を読み飛ばします。
+		/// </summary>
+		/// <remarks>
+		/// 値がオブジェクトや配列の場合は、対応する終了までをトークンを作成せずに読み飛ばします。
+		/// </remarks>
+		/// <returns>
+		/// 読み飛ばしに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool skipValue();
+
+		/// <summary>
+		/// 現在の入れ子の深さを返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の入れ子の深さ
+		/// </returns>
+		uint32 depth() const;
+
+		/// <summary>
+		/// 先頭から数えた現在の読み込み位置を返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の読み込み位置（バイト）
+		/// </returns>
+		int64 getPos() const;
+
+		/// <summary>
+		/// 構文エラーが発生したかを返します。
+		/// </summary>
+		/// <returns>
+		/// 構文エラーが発生した場合 true, それ以外の場合は false
+		/// </returns>
+		bool hasError() const;
+
+		/// <summary>
+		/// すべてのトークンを順に関数に渡します。
+		/// </summary>
+		/// <param name="handler">
+		/// トークンを受け取り、読み込みを続ける場合 true を返す関数
+		/// </param>
+		/// <returns>
+		/// データの終端まで読み込んだ場合 true, 構文エラーか関数が false を返して中断した場合は false
+		/// </returns>
+		template <class Handler>
+		bool parse(Handler handler)
+		{
+			for (;;)
+			{
+				const JSONToken token = next();
+
+				if (token.type == JSONTokenType::End)
+				{
+					return true;
+				}
+
+				if (token.type == JSONTokenType::Error || !handler(token))
+				{
+					return false;
+				}
+			}
+		}
+	};
+}
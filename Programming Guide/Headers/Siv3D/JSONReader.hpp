@@ -24,6 +24,9 @@ namespace s3d
 	/// <summary>
 	/// JSON ファイルの読み込み
 	/// </summary>
+	/// <remarks>
+	/// 全体を JSONValue のツリーとして読み込みます。大きなデータから一部の値だけを読む場合は JSONPullReader を使うと、ツリーを作成せずに済みます。
+	/// </remarks>
 	class JSONReader
 	{
 	private:
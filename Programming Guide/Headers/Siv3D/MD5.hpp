@@ -11,6 +11,8 @@
 # pragma once
 # include "Fwd.hpp"
 # include "String.hpp"
+# include "Array.hpp"
+# include "IReader.hpp"
 
 namespace s3d
 {
@@ -93,5 +95,119 @@ namespace s3d
 		/// MD5 ハッシュ値
 		/// </returns>
 		MD5Value EncryptFromFile(const FilePath& path);
+
+		/// <summary>
+		/// 複数のデータの MD5 ハッシュ値をまとめて計算します。
+		/// </summary>
+		/// <param name="data">
+		/// MD5 ハッシュ値を計算するデータの一覧
+		/// </param>
+		/// <remarks>
+		/// SIMD 命令で 4 個（SSE2）または 8 個（AVX2）のデータを同時に計算し、それを複数のスレッドで並列に行います。
+		/// </remarks>
+		/// <returns>
+		/// 各データの MD5 ハッシュ値
+		/// </returns>
+		Array<MD5Value> EncryptMultiple(const Array<ByteArray>& data);
+
+		/// <summary>
+		/// 複数のファイルの MD5 ハッシュ値をまとめて計算します。
+		/// </summary>
+		/// <param name="paths">
+		/// MD5 ハッシュ値を計算するファイルのパスの一覧
+		/// </param>
+		/// <remarks>
+		/// SIMD 命令で 4 個（SSE2）または 8 個（AVX2）のファイルを同時に計算し、それを複数のスレッドで並列に行います。
+		/// ファイルはメモリマップして読み込みます。読み込めなかったファイルのハッシュ値はすべて 0 になります。
+		/// </remarks>
+		/// <returns>
+		/// 各ファイルの MD5 ハッシュ値
+		/// </returns>
+		Array<MD5Value> EncryptFromFiles(const Array<FilePath>& paths);
+	};
+
+	/// <summary>
+	/// MD5 ハッシュ値の逐次計算
+	/// </summary>
+	/// <remarks>
+	/// データを少しずつ与えて MD5 ハッシュ値を計算します。入力全体をメモリ上に置く必要はありません。
+	/// </remarks>
+	class MD5Hasher
+	{
+	private:
+
+		uint32 m_state[4];
+
+		uint64 m_length;
+
+		uint8 m_buffer[64];
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		MD5Hasher()
+		{
+			reset();
+		}
+
+		/// <summary>
+		/// 計算の状態を初期化します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void reset();
+
+		/// <summary>
+		/// データを追加します。
+		/// </summary>
+		/// <param name="data">
+		/// 追加するデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// 追加するデータのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void update(_In_reads_bytes_(size) const void* data, size_t size);
+
+		/// <summary>
+		/// データを追加します。
+		/// </summary>
+		/// <param name="data">
+		/// 追加するデータ
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void update(const ByteArray& data);
+
+		/// <summary>
+		/// Reader の現在の位置から最後までのデータを追加します。
+		/// </summary>
+		/// <param name="reader">
+		/// 追加するデータの Reader
+		/// </param>
+		/// <remarks>
+		/// 一定のサイズのバッファを使って少しずつ読み込みます。
+		/// </remarks>
+		/// <returns>
+		/// 読み込みに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool update(IReader& reader);
+
+		/// <summary>
+		/// これまでに追加したデータの MD5 ハッシュ値を返します。
+		/// </summary>
+		/// <remarks>
+		/// 計算の状態は変更されないため、その後もデータを追加できます。
+		/// </remarks>
+		/// <returns>
+		/// MD5 ハッシュ値
+		/// </returns>
+		MD5Value finalize() const;
 	};
 }
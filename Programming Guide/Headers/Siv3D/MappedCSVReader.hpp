@@ -0,0 +1,337 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <limits>
+# include "Fwd.hpp"
+# include "Parse.hpp"
+# include "Optional.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "PropertyMacro.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// メモリマップトファイルによる高速な CSV ファイルの読み込み
+	/// </summary>
+	/// <remarks>
+	/// UTF-8 の CSV ファイルをメモリにマップし、区切り文字、引用符、改行を SIMD 命令で検索して、各フィールドの位置だけを保持します。
+	/// フィールドの文字列は取得するときに初めて作成され、数値はマップされたバイト列から直接変換されます。
+	/// 列単位の数値の取得では、列全体を一度だけ変換して連続した配列にキャッシュします。
+	/// 使用するメモリは、ファイルのサイズではなくフィールドの数に比例します（1 フィールドあたり 4 バイト、ファイルが 4 GB 以上の場合は 8 バイト）。
+	/// </remarks>
+	class MappedCSVReader
+	{
+	private:
+
+		class CMappedCSVReader;
+
+		std::shared_ptr<CMappedCSVReader> pImpl;
+
+		template <class Type, std::enable_if_t<std::is_integral<Type>::value && std::is_signed<Type>::value>* = nullptr>
+		Optional<Type> parseItem(size_t row, size_t column) const
+		{
+			if (const auto value = getInt64(row, column))
+			{
+				if (std::numeric_limits<Type>::min() <= value.value() && value.value() <= std::numeric_limits<Type>::max())
+				{
+					return static_cast<Type>(value.value());
+				}
+			}
+
+			return none;
+		}
+
+		template <class Type, std::enable_if_t<std::is_floating_point<Type>::value>* = nullptr>
+		Optional<Type> parseItem(size_t row, size_t column) const
+		{
+			if (const auto value = getDouble(row, column))
+			{
+				return static_cast<Type>(value.value());
+			}
+
+			return none;
+		}
+
+		template <class Type, std::enable_if_t<!(std::is_integral<Type>::value && std::is_signed<Type>::value) && !std::is_floating_point<Type>::value>* = nullptr>
+		Optional<Type> parseItem(size_t row, size_t column) const
+		{
+			if (const auto item = getItem(row, column))
+			{
+				return ParseOpt<Type>(item.value());
+			}
+
+			return none;
+		}
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		MappedCSVReader();
+
+		/// <summary>
+		/// CSV ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <param name="delimiter">
+		/// 区切り文字
+		/// </param>
+		/// <param name="numThreads">
+		/// 索引の作成に使うスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// numThreads が 2 以上の場合、ファイルを引用符内の改行を考慮したレコードの境界で分割し、各部分の索引を並列に作成してから結合します。
+		/// </remarks>
+		explicit MappedCSVReader(const FilePath& path, char delimiter = ',', uint32 numThreads = 0);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		~MappedCSVReader();
+
+		/// <summary>
+		/// CSV ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <param name="delimiter">
+		/// 区切り文字
+		/// </param>
+		/// <param name="numThreads">
+		/// 索引の作成に使うスレッド数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// numThreads が 2 以上の場合、ファイルを引用符内の改行を考慮したレコードの境界で分割し、各部分の索引を並列に作成してから結合します。
+		/// </remarks>
+		/// <returns>
+		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path, char delimiter = ',', uint32 numThreads = 0);
+
+		/// <summary>
+		/// CSV ファイルをクローズします。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// CSV ファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// CSV ファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// 指定した行の列数を返します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <returns>
+		/// 指定した行の列数
+		/// </returns>
+		size_t columns(size_t row) const;
+
+		/// <summary>
+		/// 指定した位置のフィールドの文字列を作成して返します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <remarks>
+		/// 引用符で囲まれたフィールドは、引用符を取り除いてエスケープを解除します。
+		/// </remarks>
+		/// <returns>
+		/// 指定した位置のフィールドの文字列。範囲外の場合は none
+		/// </returns>
+		Optional<String> getItem(size_t row, size_t column) const;
+
+		/// <summary>
+		/// 指定した位置のフィールドを、文字列を作成せずに整数に変換します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <returns>
+		/// 変換した整数。範囲外か変換に失敗した場合は none
+		/// </returns>
+		Optional<int64> getInt64(size_t row, size_t column) const;
+
+		/// <summary>
+		/// 指定した位置のフィールドを、文字列を作成せずに浮動小数点数に変換します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <returns>
+		/// 変換した浮動小数点数。範囲外か変換に失敗した場合は none
+		/// </returns>
+		Optional<double> getDouble(size_t row, size_t column) const;
+
+		/// <summary>
+		/// 指定した位置のデータを取得します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <remarks>
+		/// 符号付き整数と浮動小数点数は、文字列を作成せずに変換します。
+		/// </remarks>
+		/// <returns>
+		/// 指定した位置のデータ。変換に失敗した場合はデフォルトの値
+		/// </returns>
+		template <class Type>
+		Type get(size_t row, size_t column) const
+		{
+			if (const auto opt = getOpt<Type>(row, column))
+			{
+				return opt.value();
+			}
+
+			return Type();
+		}
+
+		/// <summary>
+		/// 指定した位置のデータを取得します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <param name="defaultValue">
+		/// 変換に失敗したときに返す値
+		/// </param>
+		/// <returns>
+		/// 指定した位置のデータ。変換に失敗した場合は defaultValue
+		/// </returns>
+		template <class Type>
+		Type getOr(size_t row, size_t column, Type&& defaultValue) const
+		{
+			return getOpt<Type>(row, column).value_or(std::move(defaultValue));
+		}
+
+		/// <summary>
+		/// 指定した位置のデータを取得します。
+		/// </summary>
+		/// <param name="row">
+		/// 行
+		/// </param>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <returns>
+		/// 指定した位置のデータの Optional 型。変換に失敗した場合は none
+		/// </returns>
+		template <class Type>
+		Optional<Type> getOpt(size_t row, size_t column) const
+		{
+			return parseItem<Type>(row, column);
+		}
+
+		/// <summary>
+		/// 指定した列のすべての行を整数に変換して返します。
+		/// </summary>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <param name="skipRows">
+		/// 先頭から読み飛ばす行数（見出しの行など）
+		/// </param>
+		/// <remarks>
+		/// column と skipRows の組み合わせごとに、初めて呼ばれたときに変換し、結果をキャッシュします。
+		/// 列が無い行や変換に失敗した行は 0 になります。行の範囲ごとに複数のスレッドで並列に変換します。
+		/// キャッシュは内部で排他制御されるため、複数のスレッドから同時に呼び出すことができます。
+		/// 返される参照は releaseColumnCache() または close() を呼ぶまで有効です。
+		/// </remarks>
+		/// <returns>
+		/// 各行の整数の配列
+		/// </returns>
+		const Array<int64>& getColumnInt64(size_t column, size_t skipRows = 0) const;
+
+		/// <summary>
+		/// 指定した列のすべての行を浮動小数点数に変換して返します。
+		/// </summary>
+		/// <param name="column">
+		/// 列
+		/// </param>
+		/// <param name="skipRows">
+		/// 先頭から読み飛ばす行数（見出しの行など）
+		/// </param>
+		/// <remarks>
+		/// column と skipRows の組み合わせごとに、初めて呼ばれたときに変換し、結果をキャッシュします。
+		/// 列が無い行や変換に失敗した行は NaN になります。行の範囲ごとに複数のスレッドで並列に変換します。
+		/// キャッシュは内部で排他制御されるため、複数のスレッドから同時に呼び出すことができます。
+		/// 返される参照は releaseColumnCache() または close() を呼ぶまで有効です。
+		/// </remarks>
+		/// <returns>
+		/// 各行の浮動小数点数の配列
+		/// </returns>
+		const Array<double>& getColumnDouble(size_t column, size_t skipRows = 0) const;
+
+		/// <summary>
+		/// キャッシュされている列の配列を解放します。
+		/// </summary>
+		/// <remarks>
+		/// それまでに返された配列の参照は無効になります。
+		/// getColumnInt64() や getColumnDouble() と同時に呼び出してはいけません。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void releaseColumnCache();
+
+		/// <summary>
+		/// CSV データが空かどうかを返します。
+		/// </summary>
+		bool isEmpty() const;
+
+		/// <summary>
+		/// CSV データの行数を示します。
+		/// </summary>
+		Property_Get(size_t, rows) const;
+
+		/// <summary>
+		/// CSV ファイルのパスを返します。
+		/// </summary>
+		FilePath path() const;
+	};
+}
@@ -0,0 +1,332 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "IReader.hpp"
+# include "ByteArray.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// メモリマップトファイルによる読み込み用バイナリファイル
+	/// </summary>
+	/// <remarks>
+	/// ファイルを読み取り専用でメモリにマップし、データをコピーせずに先頭ポインタを通してアクセスできるようにします。
+	/// Image, Wave, CSVReader, JSONReader, FileArchive は、マップされたメモリから直接データを解析します。
+	/// マップされたメモリは、オブジェクトとそのコピーがすべて破棄されるまで有効です。
+	/// </remarks>
+	class MappedFileReader : public IReader
+	{
+	private:
+
+		class CMappedFileReader;
+
+		std::shared_ptr<CMappedFileReader> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		MappedFileReader();
+
+		/// <summary>
+		/// バイナリファイルを開き、メモリにマップします。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		explicit MappedFileReader(const FilePath& path);
+
+		/// <summary>
+		/// バイナリファイルを開き、メモリにマップします。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <returns>
+		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		_Check_return_
+		bool open(const FilePath& path);
+
+		/// <summary>
+		/// マップを解除し、バイナリファイルをクローズします。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// バイナリファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		_Check_return_
+		bool isOpened() const override;
+
+		/// <summary>
+		/// バイナリファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		_Check_return_
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// バイナリファイルのサイズを返します。
+		/// </summary>
+		/// <returns>
+		/// バイナリファイルのサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 size() const override;
+
+		/// <summary>
+		/// 現在の読み込み位置を返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の読み込み位置（バイト）
+		/// </returns>
+		_Check_return_
+		int64 getPos() const override;
+
+		/// <summary>
+		/// 読み込み位置を変更します。
+		/// </summary>
+		/// <param name="pos">
+		/// 新しい読み込み位置（バイト）
+		/// </param>
+		/// <returns>
+		/// 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		_Check_return_
+		bool setPos(int64 pos) override;
+
+		/// <summary>
+		/// ファイルを読み飛ばし、読み込み位置を変更します。
+		/// </summary>
+		/// <param name="offset">
+		/// 読み飛ばすサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 新しい読み込み位置
+		/// </returns>
+		_Check_return_
+		int64 skip(int64 offset) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 size) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 read(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="to">
+		/// 読み込み先
+		/// </param>
+		/// <returns>
+		/// 読み込みに成功したら true, それ以外の場合は false
+		/// </returns>
+		template <class Type>
+		_Check_return_ bool read(Type& to)
+		{
+			static_assert(std::is_trivially_copyable<Type>::value, "MappedFileReader::read(): Type must be trivially copyable");
+
+			return IReader::read(to);
+		}
+
+		/// <summary>
+		/// 位置を指定したスレッドセーフなデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		_Check_return_
+		bool supportsPositionalRead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を使わずに、ファイルの指定した位置からデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// マップされたメモリからコピーするだけなので、複数のスレッドから同時に呼ぶことができます。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 readAt(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		_Check_return_
+		bool supportsLookahead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		_Check_return_
+		int64 lookahead(_Out_writes_bytes_all_(size) void* buffer, int64 pos, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="to">
+		/// 読み込み先
+		/// </param>
+		/// <returns>
+		/// 読み込みに成功したら true, それ以外の場合は false
+		/// </returns>
+		template <class Type>
+		_Check_return_ bool lookahead(Type& to)
+		{
+			static_assert(std::is_trivially_copyable<Type>::value, "MappedFileReader::lookahead(): Type must be trivially copyable");
+
+			return IReader::lookahead(to);
+		}
+
+		/// <summary>
+		/// マップされたファイルの先頭ポインタを返します。
+		/// </summary>
+		/// <remarks>
+		/// 現在の読み込み位置に関係なく、ファイルの先頭のポインタを返します。
+		/// クローズしている場合は nullptr です。
+		/// </remarks>
+		/// <returns>
+		/// マップされたファイルの先頭ポインタ
+		/// </returns>
+		_Check_return_
+		const uint8* data() const override;
+
+		/// <summary>
+		/// 現在の読み込み位置のポインタを返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の読み込み位置のポインタ
+		/// </returns>
+		_Check_return_
+		const uint8* current() const
+		{
+			return data() + getPos();
+		}
+
+		/// <summary>
+		/// 指定した範囲のデータを、OS に先読みするよう指示します。
+		/// </summary>
+		/// <param name="pos">
+		/// 先頭から数えた開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 先読みするサイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 指定した範囲へのアクセスで発生するページフォールトを減らします。データはコピーされません。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void prefetch(int64 pos, int64 size) const;
+
+		/// <summary>
+		/// 現在の読み込み位置から指定したサイズのデータをコピーし、ByteArray として返します。
+		/// </summary>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 読み込んだデータ
+		/// </returns>
+		_Check_return_
+		ByteArray readSubset(int64 size);
+
+		/// <summary>
+		/// オープンしているファイルのパスを返します。
+		/// </summary>
+		/// <remarks>
+		/// クローズしている場合は空の文字列です。
+		/// </remarks>
+		_Check_return_
+		FilePath path() const;
+	};
+}
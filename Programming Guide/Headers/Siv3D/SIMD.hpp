@@ -35,7 +35,17 @@ namespace s3d
 		/// <summary>
 		/// SSE4.2
 		/// </summary>
-		SSE4_2 = 42
+		SSE4_2 = 42,
+
+		/// <summary>
+		/// AVX2
+		/// </summary>
+		AVX2 = 60,
+
+		/// <summary>
+		/// AVX-512 (AVX-512F, AVX-512BW)
+		/// </summary>
+		AVX512 = 70
 	};
 
 	/// <summary>
@@ -46,6 +56,9 @@ namespace s3d
 		/// <summary>
 		/// サポートされている最大の SSE のバージョンを返します。
 		/// </summary>
+		/// <remarks>
+		/// CPUID と OS の拡張レジスタ保存のサポートから判定します。
+		/// </remarks>
 		/// <returns>
 		/// サポートされている最大の SSE のバージョン
 		/// </returns>
@@ -59,6 +72,9 @@ namespace s3d
 		/// </param>
 		/// <remarks>
 		/// デフォルトでは SupportedSSE() が設定されています。
+		/// SSE::AVX2 以上の場合、Image の negate, grayscale, sepia, brighten, gammaCorrect, threshold, postarize, ARGBtoABGR は
+		/// 256 bit (AVX2) / 512 bit (AVX-512) 幅のカーネルで処理されます。
+		/// SupportedSSE() より大きいバージョンを指定した場合は失敗します。
 		/// </remarks>
 		/// <returns>
 		/// 変更に成功した場合 true, それ以外の場合は false
@@ -11,6 +11,7 @@
 # pragma once
 # include "Asset.hpp"
 # include "Sound.hpp"
+# include "Wave.hpp"
 # include "FileArchive.hpp"
 # include "FileMonitor.hpp"
 
@@ -32,12 +33,16 @@ namespace s3d
 
 		bool preload() override;
 
+		bool decode() override;
+
 		bool update() override;
 
 		bool release() override;
 
 		const Array<AssetTag>& getTags() const override;
 
+		size_t memoryUsage() const override;
+
 		/// <summary>
 		/// デフォルトコンストラクタ
 		/// </summary>
@@ -98,6 +103,11 @@ namespace s3d
 
 		Sound sound;
 
+		/// <summary>
+		/// 非同期プリロードでデコードされ、アップロードを待っている音声波形
+		/// </summary>
+		Wave wave;
+
 		Array<AssetTag> tags;
 
 		int32 flag;
@@ -122,6 +132,9 @@ namespace s3d
 		/// <param name="name">
 		/// Sound アセット名
 		/// </param>
+		/// <remarks>
+		/// メモリ予算によってリリースされていた場合は、再びプリロードされます。
+		/// </remarks>
 		SoundAsset(const AssetName& name);
 
 		/// <summary>
@@ -248,6 +261,67 @@ namespace s3d
 		/// </returns>
 		static bool PreloadAll();
 
+		/// <summary>
+		/// Sound アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="name">
+		/// プリロードする Sound アセットの名前
+		/// </param>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <remarks>
+		/// オーディオファイルのデコードはワーカースレッドで行われ、サウンドの作成だけが System::Update() の中でメインスレッドで行われます。
+		/// 同じ優先度の要求は、同じタグを持つアセットがまとめて処理されます。
+		/// 進捗は Asset::GetLoadProgress() で取得できます。
+		/// </remarks>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadAsync(const AssetName& name, int32 priority = 0);
+
+		/// <summary>
+		/// Sound アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="tag">
+		/// プリロードする Sound アセットのタグ
+		/// </param>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <remarks>
+		/// 進捗は Asset::GetLoadProgressByTag() で取得できます。
+		/// </remarks>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadByTagAsync(const AssetTag& tag, int32 priority = 0);
+
+		/// <summary>
+		/// 登録しているすべての Sound アセットの非同期プリロードを要求します。
+		/// </summary>
+		/// <param name="priority">
+		/// 優先度。大きいほど先に処理されます
+		/// </param>
+		/// <returns>
+		/// 要求に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool PreloadAllAsync(int32 priority = 0);
+
+		/// <summary>
+		/// Sound アセットのプリロードが完了しているかを調べます。
+		/// </summary>
+		/// <param name="name">
+		/// Sound アセットの名前
+		/// </param>
+		/// <remarks>
+		/// 非同期プリロードの途中のアセットにアクセスすると、メインスレッドでプリロードが完了するまで待機します。
+		/// </remarks>
+		/// <returns>
+		/// プリロードが完了している場合 true, それ以外の場合は false
+		/// </returns>
+		static bool IsReady(const AssetName& name);
+
 		/// <summary>
 		/// Sound アセットをリリースします。
 		/// </summary>
@@ -310,5 +384,49 @@ namespace s3d
 		/// なし
 		/// </returns>
 		static void UnregisterAll();
+
+		/// <summary>
+		/// Sound アセットが使用できるメモリの予算を設定します。
+		/// </summary>
+		/// <param name="bytes">
+		/// メモリの予算（バイト）。0 の場合は無制限
+		/// </param>
+		/// <remarks>
+		/// 使用量が予算を超えると、System::Update() の中で最後にアクセスされたのが最も古い Sound アセットから順にリリースされます。
+		/// そのフレームでアクセスされたアセットと AssetFlag::Resident を指定したアセットはリリースされません。
+		/// 再生中のサウンドはリリースされません。
+		/// リリースされたアセットは、次にアクセスされたときに再びプリロードされます。デフォルトは 0 です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		static void SetMemoryBudget(size_t bytes);
+
+		/// <summary>
+		/// Sound アセットが使用できるメモリの予算を返します。
+		/// </summary>
+		/// <returns>
+		/// メモリの予算（バイト）。0 の場合は無制限
+		/// </returns>
+		static size_t GetMemoryBudget();
+
+		/// <summary>
+		/// ロードされている Sound アセットが使用しているメモリの量を返します。
+		/// </summary>
+		/// <returns>
+		/// 使用しているメモリの量（バイト）
+		/// </returns>
+		static size_t GetMemoryUsage();
+
+		/// <summary>
+		/// 指定したタグを持つ、ロードされている Sound アセットが使用しているメモリの量を返します。
+		/// </summary>
+		/// <param name="tag">
+		/// Sound アセットのタグ
+		/// </param>
+		/// <returns>
+		/// 使用しているメモリの量（バイト）
+		/// </returns>
+		static size_t GetMemoryUsageByTag(const AssetTag& tag);
 	};
 }
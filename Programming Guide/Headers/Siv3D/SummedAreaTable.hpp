@@ -0,0 +1,356 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Fwd.hpp"
+# include "Array.hpp"
+# include "Grid.hpp"
+# include "Image.hpp"
+# include "CustomImage.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// 積分画像（Summed Area Table）
+	/// </summary>
+	/// <remarks>
+	/// 長方形領域内の値の合計、平均、分散を、領域の大きさによらず一定時間で求めます。
+	/// 整数値の合計は符号付き 64 bit で累積されるため、負の値も扱えます。
+	/// </remarks>
+	template <class SumType>
+	class SummedAreaTableBase
+	{
+	private:
+
+		Array<SumType> m_sum;
+
+		Array<SumType> m_squaredSum;
+
+		int32 m_width = 0;
+
+		int32 m_height = 0;
+
+		size_t index(int32 x, int32 y) const
+		{
+			return static_cast<size_t>(y) * (m_width + 1) + x;
+		}
+
+		template <class Getter>
+		void build(int32 width, int32 height, Getter getter, bool withSquaredSum)
+		{
+			m_width = width;
+			m_height = height;
+
+			m_sum.assign(static_cast<size_t>(m_width + 1) * (m_height + 1), SumType(0));
+
+			if (withSquaredSum)
+			{
+				m_squaredSum.assign(m_sum.size(), SumType(0));
+			}
+			else
+			{
+				m_squaredSum.clear();
+			}
+
+			for (int32 y = 0; y < m_height; ++y)
+			{
+				SumType rowSum(0), rowSquaredSum(0);
+
+				for (int32 x = 0; x < m_width; ++x)
+				{
+					const SumType value = static_cast<SumType>(getter(x, y));
+
+					rowSum += value;
+
+					m_sum[index(x + 1, y + 1)] = m_sum[index(x + 1, y)] + rowSum;
+
+					if (withSquaredSum)
+					{
+						rowSquaredSum += value * value;
+
+						m_squaredSum[index(x + 1, y + 1)] = m_squaredSum[index(x + 1, y)] + rowSquaredSum;
+					}
+				}
+			}
+		}
+
+		static SumType Lookup(const Array<SumType>& table, size_t i0, size_t i1, size_t i2, size_t i3)
+		{
+			return table[i3] - table[i1] - table[i2] + table[i0];
+		}
+
+		bool clip(const Rect& rect, size_t& i0, size_t& i1, size_t& i2, size_t& i3, int64& count) const
+		{
+			const int32 x0 = Clamp(rect.x, 0, m_width);
+			const int32 y0 = Clamp(rect.y, 0, m_height);
+			const int32 x1 = Clamp(rect.x + rect.w, x0, m_width);
+			const int32 y1 = Clamp(rect.y + rect.h, y0, m_height);
+
+			count = static_cast<int64>(x1 - x0) * (y1 - y0);
+
+			if (count == 0)
+			{
+				return false;
+			}
+
+			i0 = index(x0, y0);
+			i1 = index(x1, y0);
+			i2 = index(x0, y1);
+			i3 = index(x1, y1);
+
+			return true;
+		}
+
+	public:
+
+		using value_type = SumType;
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		SummedAreaTableBase() = default;
+
+		/// <summary>
+		/// 画像のグレースケール値 [0, 255] から積分画像を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="withSquaredSum">
+		/// 分散を求めるための二乗和も作成する場合 true
+		/// </param>
+		explicit SummedAreaTableBase(const Image& image, bool withSquaredSum = true)
+		{
+			build(image.width, image.height, [&image](int32 x, int32 y) { return image[y][x].grayscale(); }, withSquaredSum);
+		}
+
+		/// <summary>
+		/// 画像から、各ピクセルを値に変換する関数を使って積分画像を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="valueOf">
+		/// ピクセルの色から値を求める関数
+		/// </param>
+		/// <param name="withSquaredSum">
+		/// 分散を求めるための二乗和も作成する場合 true
+		/// </param>
+		template <class Fty>
+		SummedAreaTableBase(const Image& image, Fty valueOf, bool withSquaredSum = true)
+		{
+			build(image.width, image.height, [&image, &valueOf](int32 x, int32 y) { return valueOf(image[y][x]); }, withSquaredSum);
+		}
+
+		/// <summary>
+		/// 画像のグレースケール値 [0.0, 1.0] から積分画像を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="withSquaredSum">
+		/// 分散を求めるための二乗和も作成する場合 true
+		/// </param>
+		/// <remarks>
+		/// SummedAreaTableF でのみ使用できます。
+		/// </remarks>
+		template <class Type>
+		explicit SummedAreaTableBase(const CustomImage<Type>& image, bool withSquaredSum = true)
+		{
+			static_assert(std::is_floating_point<SumType>::value, "SummedAreaTable from CustomImage requires a floating point SumType. Use SummedAreaTableF");
+
+			build(image.width, image.height, [&image](int32 x, int32 y) { return image[y][x].toColorF().grayscale(); }, withSquaredSum);
+		}
+
+		/// <summary>
+		/// 画像から、各ピクセルを値に変換する関数を使って積分画像を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="valueOf">
+		/// ピクセルの色から値を求める関数
+		/// </param>
+		/// <param name="withSquaredSum">
+		/// 分散を求めるための二乗和も作成する場合 true
+		/// </param>
+		template <class Type, class Fty>
+		SummedAreaTableBase(const CustomImage<Type>& image, Fty valueOf, bool withSquaredSum = true)
+			: SummedAreaTableBase(static_cast<const Grid<Type>&>(image), valueOf, withSquaredSum) {}
+
+		/// <summary>
+		/// 二次元配列から、各要素を値に変換する関数を使って積分画像を作成します。
+		/// </summary>
+		/// <param name="grid">
+		/// 二次元配列
+		/// </param>
+		/// <param name="valueOf">
+		/// 要素から値を求める関数
+		/// </param>
+		/// <param name="withSquaredSum">
+		/// 分散を求めるための二乗和も作成する場合 true
+		/// </param>
+		template <class Type, class Fty>
+		SummedAreaTableBase(const Grid<Type>& grid, Fty valueOf, bool withSquaredSum = true)
+		{
+			build(static_cast<int32>(grid.width), static_cast<int32>(grid.height), [&grid, &valueOf](int32 x, int32 y) { return valueOf(grid[y][x]); }, withSquaredSum);
+		}
+
+		/// <summary>
+		/// 積分画像が空ではないかを返します。
+		/// </summary>
+		/// <returns>
+		/// 積分画像が空ではない場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const
+		{
+			return !isEmpty;
+		}
+
+		/// <summary>
+		/// 元の画像の幅（ピクセル）
+		/// </summary>
+		Property_Get(int32, width) const { return m_width; }
+
+		/// <summary>
+		/// 元の画像の高さ（ピクセル）
+		/// </summary>
+		Property_Get(int32, height) const { return m_height; }
+
+		/// <summary>
+		/// 元の画像の幅と高さ（ピクセル）
+		/// </summary>
+		Property_Get(Size, size) const { return{ m_width, m_height }; }
+
+		/// <summary>
+		/// 積分画像が空であるか
+		/// </summary>
+		Property_Get(bool, isEmpty) const { return m_sum.empty(); }
+
+		/// <summary>
+		/// 二乗和を持っているか
+		/// </summary>
+		Property_Get(bool, hasSquaredSum) const { return !m_squaredSum.empty(); }
+
+		/// <summary>
+		/// 長方形領域内の値の合計を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 長方形領域
+		/// </param>
+		/// <remarks>
+		/// 領域は画像の内側に切り詰められます。
+		/// </remarks>
+		/// <returns>
+		/// 値の合計
+		/// </returns>
+		SumType sum(const Rect& rect) const
+		{
+			size_t i0, i1, i2, i3;
+			int64 count;
+
+			if (!clip(rect, i0, i1, i2, i3, count))
+			{
+				return SumType(0);
+			}
+
+			return Lookup(m_sum, i0, i1, i2, i3);
+		}
+
+		/// <summary>
+		/// 長方形領域内の値の二乗和を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 長方形領域
+		/// </param>
+		/// <remarks>
+		/// 領域は画像の内側に切り詰められます。二乗和を持っていない場合は 0 を返します。
+		/// </remarks>
+		/// <returns>
+		/// 値の二乗和
+		/// </returns>
+		SumType squaredSum(const Rect& rect) const
+		{
+			size_t i0, i1, i2, i3;
+			int64 count;
+
+			if (!hasSquaredSum || !clip(rect, i0, i1, i2, i3, count))
+			{
+				return SumType(0);
+			}
+
+			return Lookup(m_squaredSum, i0, i1, i2, i3);
+		}
+
+		/// <summary>
+		/// 長方形領域内の値の平均を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 長方形領域
+		/// </param>
+		/// <remarks>
+		/// 領域は画像の内側に切り詰められます。
+		/// </remarks>
+		/// <returns>
+		/// 値の平均。領域が空の場合は 0.0
+		/// </returns>
+		double mean(const Rect& rect) const
+		{
+			size_t i0, i1, i2, i3;
+			int64 count;
+
+			if (!clip(rect, i0, i1, i2, i3, count))
+			{
+				return 0.0;
+			}
+
+			return static_cast<double>(Lookup(m_sum, i0, i1, i2, i3)) / count;
+		}
+
+		/// <summary>
+		/// 長方形領域内の値の分散を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 長方形領域
+		/// </param>
+		/// <remarks>
+		/// 領域は画像の内側に切り詰められます。二乗和を持っていない場合は 0.0 を返します。
+		/// </remarks>
+		/// <returns>
+		/// 値の分散。領域が空の場合は 0.0
+		/// </returns>
+		double variance(const Rect& rect) const
+		{
+			size_t i0, i1, i2, i3;
+			int64 count;
+
+			if (!hasSquaredSum || !clip(rect, i0, i1, i2, i3, count))
+			{
+				return 0.0;
+			}
+
+			const double m = static_cast<double>(Lookup(m_sum, i0, i1, i2, i3)) / count;
+
+			const double m2 = static_cast<double>(Lookup(m_squaredSum, i0, i1, i2, i3)) / count;
+
+			return std::max(m2 - m * m, 0.0);
+		}
+	};
+
+	/// <summary>
+	/// 整数値の積分画像
+	/// </summary>
+	using SummedAreaTable = SummedAreaTableBase<int64>;
+
+	/// <summary>
+	/// 浮動小数点数値の積分画像
+	/// </summary>
+	using SummedAreaTableF = SummedAreaTableBase<double>;
+}
@@ -9,22 +9,616 @@
 //-----------------------------------------------
 
 # pragma once
+# include <cassert>
+# include <memory>
+# include <future>
+# include <mutex>
+# include <atomic>
+# include <functional>
 # include "Fwd.hpp"
 # include "Array.hpp"
+# include "Grid.hpp"
 # include "String.hpp"
 # include "Image.hpp"
 # include "Wave.hpp"
 
 namespace s3d
 {
+	/// <summary>
+	/// キャンセルトークン
+	/// </summary>
+	/// <remarks>
+	/// コピーしたトークンは同じキャンセル状態を共有します。
+	/// </remarks>
+	class CancellationToken
+	{
+	private:
+
+		std::shared_ptr<std::atomic<bool>> m_canceled = std::make_shared<std::atomic<bool>>(false);
+
+	public:
+
+		/// <summary>
+		/// キャンセルを要求します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void cancel() const
+		{
+			m_canceled->store(true);
+		}
+
+		/// <summary>
+		/// キャンセルが要求されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// キャンセルが要求されている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isCanceled() const
+		{
+			return m_canceled->load();
+		}
+	};
+
+	namespace Threading
+	{
+		/// <summary>
+		/// 共有スレッドプールのワーカースレッドの数を返します。
+		/// </summary>
+		/// <returns>
+		/// ワーカースレッドの数
+		/// </returns>
+		size_t GetWorkerCount();
+
+		/// <summary>
+		/// 共有スレッドプールのワーカースレッドの数を設定します。
+		/// </summary>
+		/// <param name="numThreads">
+		/// ワーカースレッドの数。0 の場合はハードウェアがサポートするスレッド数
+		/// </param>
+		/// <remarks>
+		/// デフォルトではハードウェアがサポートするスレッド数が設定されています。
+		/// 画像処理、音声処理、ファイルの読み書きなど、エンジンの並列処理はすべてこのスレッドプールで実行されます。
+		/// </remarks>
+		/// <returns>
+		/// 変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool SetWorkerCount(size_t numThreads);
+
+		/// <summary>
+		/// 共有スレッドプールにジョブを追加します。
+		/// </summary>
+		/// <param name="job">
+		/// ジョブ
+		/// </param>
+		/// <remarks>
+		/// 各ワーカースレッドは自身のキューを持ち、キューが空になると他のワーカースレッドのキューからジョブを奪って実行します（ワークスティーリング）。
+		/// ワーカースレッドから追加したジョブは、そのスレッドのキューに追加されます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void Submit(std::function<void()> job);
+
+		/// <summary>
+		/// 範囲を分割し、共有スレッドプールで並列に処理します。
+		/// </summary>
+		/// <param name="begin">
+		/// 範囲の開始
+		/// </param>
+		/// <param name="end">
+		/// 範囲の終端（この値を含まない）
+		/// </param>
+		/// <param name="body">
+		/// 分割された範囲 [begin, end) を処理する関数
+		/// </param>
+		/// <param name="grainSize">
+		/// 分割する範囲の最小の大きさ。0 の場合は自動で決定
+		/// </param>
+		/// <param name="token">
+		/// キャンセルトークン
+		/// </param>
+		/// <remarks>
+		/// 呼び出し元のスレッドも処理に参加し、すべての処理が完了するまで戻りません。
+		/// キャンセルが要求されると、まだ開始していない範囲は処理されません。
+		/// </remarks>
+		/// <returns>
+		/// すべての範囲を処理した場合 true, キャンセルされた場合は false
+		/// </returns>
+		bool ParallelForRange(int64 begin, int64 end, const std::function<void(int64, int64)>& body, int64 grainSize = 0, const CancellationToken& token = CancellationToken());
+	}
+
+	template <class Type> class Task;
+
+	namespace detail
+	{
+		struct TaskState
+		{
+			std::mutex mutex;
+
+			bool finished = false;
+
+			Array<std::function<void()>> continuations;
+
+			void finish()
+			{
+				Array<std::function<void()>> continuationsToRun;
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+
+					finished = true;
+
+					continuationsToRun.swap(continuations);
+				}
+
+				for (auto& continuation : continuationsToRun)
+				{
+					Threading::Submit(std::move(continuation));
+				}
+			}
+
+			void onFinished(std::function<void()> continuation)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+
+					if (!finished)
+					{
+						continuations.push_back(std::move(continuation));
+
+						return;
+					}
+				}
+
+				Threading::Submit(std::move(continuation));
+			}
+		};
+
+		template <class Type, class Fty>
+		inline void FulfillTask(std::promise<Type>& promise, Fty& function, std::false_type)
+		{
+			try
+			{
+				promise.set_value(function());
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+			}
+		}
+
+		template <class Type, class Fty>
+		inline void FulfillTask(std::promise<Type>& promise, Fty& function, std::true_type)
+		{
+			try
+			{
+				function();
+
+				promise.set_value();
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+			}
+		}
+
+		template <class Type, class Fty>
+		inline Task<Type> LaunchTask(Fty function, const CancellationToken& token, std::function<void(std::function<void()>)> schedule);
+	}
+
+	/// <summary>
+	/// 非同期タスク
+	/// </summary>
+	/// <remarks>
+	/// Threading::Async() で作成します。then() で、完了後に実行される継続タスクを追加できます。
+	/// </remarks>
+	template <class Type>
+	class Task
+	{
+	private:
+
+		template <class T, class Fty>
+		friend Task<T> detail::LaunchTask(Fty, const CancellationToken&, std::function<void(std::function<void()>)>);
+
+		std::shared_ptr<detail::TaskState> m_state;
+
+		std::shared_future<Type> m_future;
+
+		Task(const std::shared_ptr<detail::TaskState>& state, std::shared_future<Type>&& future)
+			: m_state(state)
+			, m_future(std::move(future)) {}
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		Task() = default;
+
+		/// <summary>
+		/// タスクが有効であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// タスクが有効な場合 true, それ以外の場合は false
+		/// </returns>
+		bool isValid() const
+		{
+			return m_future.valid();
+		}
+
+		/// <summary>
+		/// タスクが完了しているかを返します。
+		/// </summary>
+		/// <returns>
+		/// タスクが完了している場合 true, それ以外の場合は false
+		/// </returns>
+		bool isReady() const
+		{
+			return isValid() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+
+		/// <summary>
+		/// タスクが完了するまで待機します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void wait() const
+		{
+			assert(isValid());
+
+			m_future.wait();
+		}
+
+		/// <summary>
+		/// タスクが完了するまで待機し、結果を返します。
+		/// </summary>
+		/// <remarks>
+		/// タスクが例外を送出した場合は、その例外を再送出します。
+		/// キャンセルされたタスクは std::future_error を送出します。
+		/// 無効なタスクに対して呼び出してはいけません。
+		/// </remarks>
+		/// <returns>
+		/// タスクの結果
+		/// </returns>
+		decltype(auto) get() const
+		{
+			assert(isValid());
+
+			return m_future.get();
+		}
+
+		/// <summary>
+		/// このタスクの完了後に実行される継続タスクを追加します。
+		/// </summary>
+		/// <param name="function">
+		/// 完了したこのタスクを受け取る関数
+		/// </param>
+		/// <param name="token">
+		/// キャンセルトークン
+		/// </param>
+		/// <returns>
+		/// 継続タスク。このタスクが無効な場合は無効なタスク
+		/// </returns>
+		template <class Fty>
+		auto then(Fty function, const CancellationToken& token = CancellationToken()) const
+		{
+			using Result = decltype(function(std::declval<const Task&>()));
+
+			if (!isValid())
+			{
+				return Task<Result>();
+			}
+
+			const Task self = *this;
+
+			const std::shared_ptr<detail::TaskState> state = m_state;
+
+			return detail::LaunchTask<Result>([self, function]() mutable { return function(self); }, token,
+				[state](std::function<void()> job) { state->onFinished(std::move(job)); });
+		}
+	};
+
+	namespace detail
+	{
+		template <class Type, class Fty>
+		inline Task<Type> LaunchTask(Fty function, const CancellationToken& token, std::function<void(std::function<void()>)> schedule)
+		{
+			const auto state = std::make_shared<TaskState>();
+
+			const auto promise = std::make_shared<std::promise<Type>>();
+
+			Task<Type> task(state, promise->get_future().share());
+
+			schedule([state, promise, function, token]() mutable
+			{
+				if (token.isCanceled())
+				{
+					promise->set_exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+				}
+				else
+				{
+					FulfillTask(*promise, function, std::is_void<Type>());
+				}
+
+				state->finish();
+			});
+
+			return task;
+		}
+	}
+
 	namespace Threading
 	{
+		/// <summary>
+		/// 関数を共有スレッドプールで非同期に実行します。
+		/// </summary>
+		/// <param name="function">
+		/// 実行する関数
+		/// </param>
+		/// <param name="token">
+		/// キャンセルトークン
+		/// </param>
+		/// <remarks>
+		/// 実行開始前にキャンセルが要求された場合、関数は実行されません。
+		/// </remarks>
+		/// <returns>
+		/// タスク
+		/// </returns>
+		template <class Fty>
+		inline auto Async(Fty function, const CancellationToken& token = CancellationToken())
+		{
+			using Result = decltype(function());
+
+			return detail::LaunchTask<Result>(function, token, [](std::function<void()> job) { Submit(std::move(job)); });
+		}
+
+		/// <summary>
+		/// 範囲内の各インデックスについて、関数を共有スレッドプールで並列に実行します。
+		/// </summary>
+		/// <param name="begin">
+		/// 範囲の開始
+		/// </param>
+		/// <param name="end">
+		/// 範囲の終端（この値を含まない）
+		/// </param>
+		/// <param name="function">
+		/// インデックスを受け取る関数
+		/// </param>
+		/// <param name="token">
+		/// キャンセルトークン
+		/// </param>
+		/// <returns>
+		/// すべてのインデックスを処理した場合 true, キャンセルされた場合は false
+		/// </returns>
+		template <class Fty>
+		inline bool ParallelFor(int64 begin, int64 end, Fty function, const CancellationToken& token = CancellationToken())
+		{
+			return ParallelForRange(begin, end, [&function](int64 first, int64 last)
+			{
+				for (int64 i = first; i < last; ++i)
+				{
+					function(i);
+				}
+			}, 0, token);
+		}
+
+		/// <summary>
+		/// 二次元配列の各行について、関数を共有スレッドプールで並列に実行します。
+		/// </summary>
+		/// <param name="grid">
+		/// 二次元配列
+		/// </param>
+		/// <param name="function">
+		/// 行の先頭ポインタと行の位置を受け取る関数
+		/// </param>
+		/// <param name="token">
+		/// キャンセルトークン
+		/// </param>
+		/// <returns>
+		/// すべての行を処理した場合 true, キャンセルされた場合は false
+		/// </returns>
+		template <class Type, class Fty>
+		inline bool ParallelForRows(Grid<Type>& grid, Fty function, const CancellationToken& token = CancellationToken())
+		{
+			return ParallelForRange(0, static_cast<int64>(grid.height), [&grid, &function](int64 first, int64 last)
+			{
+				for (int64 y = first; y < last; ++y)
+				{
+					function(grid[static_cast<size_t>(y)], static_cast<size_t>(y));
+				}
+			}, 1, token);
+		}
+
+		/// <summary>
+		/// 複数の画像ファイルを共有スレッドプールで並列にロードします。
+		/// </summary>
+		/// <param name="paths">
+		/// 画像ファイルのパス
+		/// </param>
+		/// <returns>
+		/// ロードした画像。失敗した画像は空の画像
+		/// </returns>
 		Array<Image> LoadImages(const Array<FilePath>& paths);
 
+		/// <summary>
+		/// 複数の画像を共有スレッドプールで並列に保存します。
+		/// </summary>
+		/// <param name="images">
+		/// 画像
+		/// </param>
+		/// <param name="paths">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <returns>
+		/// すべての保存に成功した場合 true, それ以外の場合は false
+		/// </returns>
 		bool SaveImages(const Array<Image>& images, const Array<FilePath>& paths);
 
+		/// <summary>
+		/// 複数の音声ファイルを共有スレッドプールで並列にロードします。
+		/// </summary>
+		/// <param name="paths">
+		/// 音声ファイルのパス
+		/// </param>
+		/// <returns>
+		/// ロードした音声波形。失敗した音声波形は空
+		/// </returns>
 		Array<Wave> LoadWaves(const Array<FilePath>& paths);
 
+		/// <summary>
+		/// 複数の音声波形を共有スレッドプールで並列に保存します。
+		/// </summary>
+		/// <param name="waves">
+		/// 音声波形
+		/// </param>
+		/// <param name="paths">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <returns>
+		/// すべての保存に成功した場合 true, それ以外の場合は false
+		/// </returns>
 		bool SaveWaves(const Array<Wave>& waves, const Array<FilePath>& paths);
+
+		/// <summary>
+		/// エンジンが管理する画像保存キューを使って、画像をバックグラウンドで保存します。
+		/// </summary>
+		/// <param name="image">
+		/// 保存する画像
+		/// </param>
+		/// <param name="path">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		/// <remarks>
+		/// キューが満杯の場合は空きができるまで待機します。
+		/// アプリケーションの終了時には、キューに残っているすべての画像の保存が完了するまで待機します。
+		/// </remarks>
+		/// <returns>
+		/// 保存に成功したかを受け取る future
+		/// </returns>
+		std::future<bool> SaveImageAsync(Image&& image, const FilePath& path, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// エンジンが管理する画像保存キューのすべての保存が完了するまで待機します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void FlushImageSaves();
 	}
+
+	/// <summary>
+	/// 画像保存キュー
+	/// </summary>
+	/// <remarks>
+	/// 画像のエンコードとファイルへの書き込みをバックグラウンドのスレッドで行います。
+	/// キューの長さには上限があり、満杯の場合 push() は空きができるまで待機します。
+	/// デストラクタは、キューに残っているすべての画像の保存が完了するまで待機します。
+	/// </remarks>
+	class ImageSaveQueue
+	{
+	private:
+
+		class CImageSaveQueue;
+
+		std::shared_ptr<CImageSaveQueue> pImpl;
+
+	public:
+
+		/// <summary>
+		/// 画像保存キューを作成します。
+		/// </summary>
+		/// <param name="capacity">
+		/// キューに保持できる画像の最大数
+		/// </param>
+		/// <param name="numThreads">
+		/// エンコードと書き込みに使うスレッド数
+		/// </param>
+		explicit ImageSaveQueue(size_t capacity = 16, size_t numThreads = 2);
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		/// <remarks>
+		/// キューに残っているすべての画像の保存が完了するまで待機します。
+		/// </remarks>
+		~ImageSaveQueue();
+
+		/// <summary>
+		/// 画像をキューに追加します。
+		/// </summary>
+		/// <param name="image">
+		/// 保存する画像
+		/// </param>
+		/// <param name="path">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		/// <remarks>
+		/// キューが満杯の場合は空きができるまで待機します。
+		/// </remarks>
+		/// <returns>
+		/// 保存に成功したかを受け取る future
+		/// </returns>
+		std::future<bool> push(Image&& image, const FilePath& path, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// キューに空きがある場合のみ画像をキューに追加します。
+		/// </summary>
+		/// <param name="image">
+		/// 保存する画像
+		/// </param>
+		/// <param name="path">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="format">
+		/// 画像のフォーマット
+		/// </param>
+		/// <remarks>
+		/// キューが満杯の場合は待機せず、image は変更されません。
+		/// </remarks>
+		/// <returns>
+		/// 保存に成功したかを受け取る future, キューが満杯の場合は無効な future (valid() が false)
+		/// </returns>
+		std::future<bool> tryPush(Image&& image, const FilePath& path, ImageFormat format = ImageFormat::Unspecified);
+
+		/// <summary>
+		/// キューに残っているすべての画像の保存が完了するまで待機します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void flush();
+
+		/// <summary>
+		/// 保存待ちの画像の数を返します。
+		/// </summary>
+		/// <returns>
+		/// 保存待ちの画像の数
+		/// </returns>
+		size_t size() const;
+
+		/// <summary>
+		/// キューに保持できる画像の最大数を返します。
+		/// </summary>
+		/// <returns>
+		/// キューに保持できる画像の最大数
+		/// </returns>
+		size_t capacity() const;
+
+		/// <summary>
+		/// キューが満杯であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// キューが満杯の場合 true, それ以外の場合は false
+		/// </returns>
+		bool isFull() const { return size() >= capacity(); }
+	};
 }
@@ -0,0 +1,382 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "PropertyMacro.hpp"
+# include "Color.hpp"
+# include "Image.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// タイル分割された大きな画像
+	/// </summary>
+	/// <remarks>
+	/// 画像を 256x256 ピクセルのタイルに分割してファイルに保存し、メモリマップトファイルを通して必要なタイルだけを読み書きします。
+	/// 最近使われたタイルは LRU キャッシュに保持されます。
+	/// Image の最大サイズや 4 GB を超える画像を扱うことができます。
+	/// </remarks>
+	class TiledImage
+	{
+	private:
+
+		class CTiledImage;
+
+		std::shared_ptr<CTiledImage> pImpl;
+
+		static int64 Mod(int64 x, int64 y)
+		{
+			const int64 r = x % y;
+
+			return r < 0 ? r + y : r;
+		}
+
+		static int64 Mir(int64 x, int64 y)
+		{
+			const int64 t = Mod(x, y * 2);
+
+			return t >= y ? (y * 2) - 1 - t : t;
+		}
+
+		static double Biliner(double c1, double c2, double c3, double c4, double px, double py)
+		{
+			return px * py * (c1 - c2 - c3 + c4) + px * (c2 - c1) + py * (c3 - c1) + c1;
+		}
+
+		Color getPixelUnchecked(int64 y, int64 x) const;
+
+	public:
+
+		/// <summary>
+		/// タイルの幅と高さ（ピクセル）
+		/// </summary>
+		static constexpr int32 TileSize = 256;
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		TiledImage();
+
+		/// <summary>
+		/// タイル画像ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// タイル画像ファイルのパス
+		/// </param>
+		explicit TiledImage(const FilePath& path);
+
+		/// <summary>
+		/// 指定した色、サイズで塗りつぶされたタイル画像ファイルを作成します。
+		/// </summary>
+		/// <param name="path">
+		/// タイル画像ファイルのパス
+		/// </param>
+		/// <param name="width">
+		/// 画像の幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 画像の高さ（ピクセル）
+		/// </param>
+		/// <param name="color">
+		/// 塗りつぶしの色
+		/// </param>
+		TiledImage(const FilePath& path, int64 width, int64 height, const Color& color = Color(0, 0));
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		/// <remarks>
+		/// 変更されたタイルはファイルに書き戻されます。
+		/// </remarks>
+		~TiledImage();
+
+		/// <summary>
+		/// タイル画像ファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// タイル画像ファイルのパス
+		/// </param>
+		/// <returns>
+		/// オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path);
+
+		/// <summary>
+		/// 指定した色、サイズで塗りつぶされたタイル画像ファイルを作成します。
+		/// </summary>
+		/// <param name="path">
+		/// タイル画像ファイルのパス
+		/// </param>
+		/// <param name="width">
+		/// 画像の幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 画像の高さ（ピクセル）
+		/// </param>
+		/// <param name="color">
+		/// 塗りつぶしの色
+		/// </param>
+		/// <returns>
+		/// 作成に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool create(const FilePath& path, int64 width, int64 height, const Color& color = Color(0, 0));
+
+		/// <summary>
+		/// タイル画像ファイルを閉じます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// タイル画像ファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// タイル画像ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		bool isOpened() const;
+
+		/// <summary>
+		/// タイル画像ファイルがオープンされているかを返します。
+		/// </summary>
+		/// <returns>
+		/// タイル画像ファイルがオープンされている場合 true, それ以外の場合は false
+		/// </returns>
+		explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// 画像の幅（ピクセル）
+		/// </summary>
+		Property_Get(int64, width) const;
+
+		/// <summary>
+		/// 画像の高さ（ピクセル）
+		/// </summary>
+		Property_Get(int64, height) const;
+
+		/// <summary>
+		/// 横方向のタイルの数
+		/// </summary>
+		Property_Get(int32, num_tiles_x) const { return static_cast<int32>((width + TileSize - 1) / TileSize); }
+
+		/// <summary>
+		/// 縦方向のタイルの数
+		/// </summary>
+		Property_Get(int32, num_tiles_y) const { return static_cast<int32>((height + TileSize - 1) / TileSize); }
+
+		/// <summary>
+		/// 画像のデータサイズ
+		/// </summary>
+		uint64 memorySize() const { return static_cast<uint64>(width) * height * sizeof(Color); }
+
+		/// <summary>
+		/// メモリ上に保持するタイルの最大数を設定します。
+		/// </summary>
+		/// <param name="numTiles">
+		/// タイルの最大数
+		/// </param>
+		/// <remarks>
+		/// 超えた場合は最も長い間使われていないタイルから解放されます。デフォルトは 1024 (256 MB) です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setCacheSize(size_t numTiles);
+
+		/// <summary>
+		/// メモリ上に保持するタイルの最大数を返します。
+		/// </summary>
+		/// <returns>
+		/// タイルの最大数
+		/// </returns>
+		size_t getCacheSize() const;
+
+		/// <summary>
+		/// 変更されたタイルをファイルに書き戻します。
+		/// </summary>
+		/// <returns>
+		/// 書き戻しに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool flush();
+
+		/// <summary>
+		/// 指定したタイルのコピーを返します。
+		/// </summary>
+		/// <param name="tileX">
+		/// 横方向のタイルのインデックス
+		/// </param>
+		/// <param name="tileY">
+		/// 縦方向のタイルのインデックス
+		/// </param>
+		/// <remarks>
+		/// 画像の右端・下端のタイルは TileSize より小さくなります。
+		/// </remarks>
+		/// <returns>
+		/// タイルの画像
+		/// </returns>
+		Image getTile(int32 tileX, int32 tileY) const;
+
+		/// <summary>
+		/// 指定した位置のピクセルの色を返します。
+		/// </summary>
+		/// <param name="y">
+		/// Y 座標
+		/// </param>
+		/// <param name="x">
+		/// X 座標
+		/// </param>
+		/// <returns>
+		/// ピクセルの色
+		/// </returns>
+		template <ImageAddressMode addressMode = ImageAddressMode::Clamp>
+		Color getPixel(int64 y, int64 x) const;
+
+		template <>
+		Color getPixel<ImageAddressMode::Wrap>(int64 y, int64 x) const
+		{
+			return getPixelUnchecked(Mod(y, height), Mod(x, width));
+		}
+
+		template <>
+		Color getPixel<ImageAddressMode::Mirror>(int64 y, int64 x) const
+		{
+			return getPixelUnchecked(Mir(y, height), Mir(x, width));
+		}
+
+		template <>
+		Color getPixel<ImageAddressMode::Clamp>(int64 y, int64 x) const
+		{
+			return getPixelUnchecked(Clamp<int64>(y, 0, height - 1), Clamp<int64>(x, 0, width - 1));
+		}
+
+		/// <summary>
+		/// 指定した位置の色をバイリニア補間で求めます。
+		/// </summary>
+		/// <param name="y">
+		/// Y 座標
+		/// </param>
+		/// <param name="x">
+		/// X 座標
+		/// </param>
+		/// <returns>
+		/// 補間された色
+		/// </returns>
+		template <ImageAddressMode addressMode = ImageAddressMode::Clamp>
+		ColorF sample(double y, double x) const
+		{
+			const int64 ix = static_cast<int64>(x);
+			const int64 iy = static_cast<int64>(y);
+
+			const Color c1 = getPixel<addressMode>(iy, ix);
+			const Color c2 = getPixel<addressMode>(iy, ix + 1);
+			const Color c3 = getPixel<addressMode>(iy + 1, ix);
+			const Color c4 = getPixel<addressMode>(iy + 1, ix + 1);
+
+			const double xr1 = x - ix;
+			const double yr1 = y - iy;
+
+			const double r = Biliner(c1.r, c2.r, c3.r, c4.r, xr1, yr1);
+			const double g = Biliner(c1.g, c2.g, c3.g, c4.g, xr1, yr1);
+			const double b = Biliner(c1.b, c2.b, c3.b, c4.b, xr1, yr1);
+			const double a = Biliner(c1.a, c2.a, c3.a, c4.a, xr1, yr1);
+
+			return{ r / 255.0, g / 255.0, b / 255.0, a / 255.0 };
+		}
+
+		/// <summary>
+		/// 指定した位置のピクセルの色を変更します。
+		/// </summary>
+		/// <param name="y">
+		/// Y 座標
+		/// </param>
+		/// <param name="x">
+		/// X 座標
+		/// </param>
+		/// <param name="color">
+		/// 新しい色
+		/// </param>
+		/// <remarks>
+		/// 画像の範囲外を指定した場合は何もしません。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setPixel(int64 y, int64 x, const Color& color);
+
+		/// <summary>
+		/// 画像の一部分をコピーした新しい画像を返します。
+		/// </summary>
+		/// <param name="x">
+		/// 画像上の範囲の左上 X 座標
+		/// </param>
+		/// <param name="y">
+		/// 画像上の範囲の左上 Y 座標
+		/// </param>
+		/// <param name="w">
+		/// 画像上の範囲の幅
+		/// </param>
+		/// <param name="h">
+		/// 画像上の範囲の高さ
+		/// </param>
+		/// <remarks>
+		/// 範囲は Image の最大サイズ以下である必要があります。
+		/// </remarks>
+		/// <returns>
+		/// 一部分をコピーした新しい画像
+		/// </returns>
+		Image clip(int64 x, int64 y, int32 w, int32 h) const;
+
+		/// <summary>
+		/// 画像の一部分をコピーした新しいタイル画像ファイルを作成します。
+		/// </summary>
+		/// <param name="path">
+		/// 新しいタイル画像ファイルのパス
+		/// </param>
+		/// <param name="x">
+		/// 画像上の範囲の左上 X 座標
+		/// </param>
+		/// <param name="y">
+		/// 画像上の範囲の左上 Y 座標
+		/// </param>
+		/// <param name="w">
+		/// 画像上の範囲の幅
+		/// </param>
+		/// <param name="h">
+		/// 画像上の範囲の高さ
+		/// </param>
+		/// <remarks>
+		/// 範囲がタイルの境界に揃っている場合、タイルはそのままコピーされます。
+		/// </remarks>
+		/// <returns>
+		/// 一部分をコピーした新しいタイル画像
+		/// </returns>
+		TiledImage clip(const FilePath& path, int64 x, int64 y, int64 w, int64 h) const;
+
+		/// <summary>
+		/// 画像を上書きして書き込みます。
+		/// </summary>
+		/// <param name="image">
+		/// 書き込む画像
+		/// </param>
+		/// <param name="x">
+		/// 書き込み開始位置の X 座標
+		/// </param>
+		/// <param name="y">
+		/// 書き込み開始位置の Y 座標
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void overwrite(const Image& image, int64 x, int64 y);
+	};
+}
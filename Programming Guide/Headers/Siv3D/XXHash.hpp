@@ -0,0 +1,213 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (C) 2008-2016 Ryo Suzuki
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Fwd.hpp"
+# include "String.hpp"
+# include "StringView.hpp"
+# include "Array.hpp"
+# include "IReader.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// xxHash64
+	/// </summary>
+	/// <remarks>
+	/// データから 64 bit の非暗号学的ハッシュ値を高速に計算する機能を提供します。
+	/// MD5 よりはるかに高速で、内容によるデータの同一性の判定に適しています。改ざんの検出には使えません。
+	/// </remarks>
+	namespace XXHash64
+	{
+		/// <summary>
+		/// データから xxHash64 ハッシュ値を計算します。
+		/// </summary>
+		/// <param name="data">
+		/// ハッシュ値を計算するデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// ハッシュ値を計算するデータのサイズ（バイト）
+		/// </param>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		/// <returns>
+		/// xxHash64 ハッシュ値
+		/// </returns>
+		uint64 Hash(_In_reads_bytes_(size) const void* data, size_t size, uint64 seed = 0);
+
+		/// <summary>
+		/// データから xxHash64 ハッシュ値を計算します。
+		/// </summary>
+		/// <param name="data">
+		/// ハッシュ値を計算するデータ
+		/// </param>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		/// <returns>
+		/// xxHash64 ハッシュ値
+		/// </returns>
+		uint64 Hash(const ByteArray& data, uint64 seed = 0);
+
+		/// <summary>
+		/// 文字列データから xxHash64 ハッシュ値を計算します。
+		/// </summary>
+		/// <param name="str">
+		/// ハッシュ値を計算する文字列データ
+		/// </param>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		/// <returns>
+		/// xxHash64 ハッシュ値
+		/// </returns>
+		inline uint64 HashFromString(StringView str, uint64 seed = 0)
+		{
+			return Hash(str.data(), str.length() * sizeof(wchar), seed);
+		}
+
+		/// <summary>
+		/// 指定したファイルの xxHash64 ハッシュ値を計算します。
+		/// </summary>
+		/// <param name="path">
+		/// ハッシュ値を計算するファイルのパス
+		/// </param>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		/// <remarks>
+		/// ファイルはメモリマップして読み込みます。
+		/// </remarks>
+		/// <returns>
+		/// xxHash64 ハッシュ値
+		/// </returns>
+		uint64 HashFromFile(const FilePath& path, uint64 seed = 0);
+
+		/// <summary>
+		/// 複数のファイルの xxHash64 ハッシュ値を、複数のスレッドで並列に計算します。
+		/// </summary>
+		/// <param name="paths">
+		/// ハッシュ値を計算するファイルのパスの一覧
+		/// </param>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		/// <remarks>
+		/// 読み込めなかったファイルのハッシュ値は 0 になります。
+		/// </remarks>
+		/// <returns>
+		/// 各ファイルの xxHash64 ハッシュ値
+		/// </returns>
+		Array<uint64> HashFromFiles(const Array<FilePath>& paths, uint64 seed = 0);
+	}
+
+	/// <summary>
+	/// xxHash64 ハッシュ値の逐次計算
+	/// </summary>
+	/// <remarks>
+	/// データを少しずつ与えて xxHash64 ハッシュ値を計算します。入力全体をメモリ上に置く必要はありません。
+	/// 結果は同じデータに対する XXHash64::Hash() と一致します。
+	/// </remarks>
+	class XXHash64Hasher
+	{
+	private:
+
+		uint64 m_state[4];
+
+		uint64 m_seed;
+
+		uint64 m_length;
+
+		uint8 m_buffer[32];
+
+	public:
+
+		/// <summary>
+		/// シード値を指定して XXHash64Hasher を作成します。
+		/// </summary>
+		/// <param name="seed">
+		/// シード値
+		/// </param>
+		explicit XXHash64Hasher(uint64 seed = 0)
+		{
+			reset(seed);
+		}
+
+		/// <summary>
+		/// 現在のシード値で計算の状態を初期化します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void reset()
+		{
+			reset(m_seed);
+		}
+
+		/// <summary>
+		/// シード値を変更して計算の状態を初期化します。
+		/// </summary>
+		/// <param name="seed">
+		/// 新しいシード値
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void reset(uint64 seed);
+
+		/// <summary>
+		/// データを追加します。
+		/// </summary>
+		/// <param name="data">
+		/// 追加するデータの先頭ポインタ
+		/// </param>
+		/// <param name="size">
+		/// 追加するデータのサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void update(_In_reads_bytes_(size) const void* data, size_t size);
+
+		/// <summary>
+		/// データを追加します。
+		/// </summary>
+		/// <param name="data">
+		/// 追加するデータ
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void update(const ByteArray& data);
+
+		/// <summary>
+		/// Reader の現在の位置から最後までのデータを追加します。
+		/// </summary>
+		/// <param name="reader">
+		/// 追加するデータの Reader
+		/// </param>
+		/// <returns>
+		/// 読み込みに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool update(IReader& reader);
+
+		/// <summary>
+		/// これまでに追加したデータの xxHash64 ハッシュ値を返します。
+		/// </summary>
+		/// <remarks>
+		/// 計算の状態は変更されないため、その後もデータを追加できます。
+		/// </remarks>
+		/// <returns>
+		/// xxHash64 ハッシュ値
+		/// </returns>
+		uint64 finalize() const;
+	};
+}